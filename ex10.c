@@ -0,0 +1,282 @@
+// accessibilite pour un lot de sources: au lieu d'un parcours par source, on traite
+// 256 sources a la fois avec un masque de bits par sommet propage le long des liens,
+// et on retourne les sommets accessibles ou leur nombre pour chaque source.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// accessibilite multi-sources en parallele sur les bits
+// chaque sommet a un masque de MOTS mots de 64 bits: le bit k est a 1 si le sommet
+// est accessible depuis la k-ieme source du lot -> 64 * MOTS sources par passage
+// on propage les masques le long des liens (file de sommets dont le masque a change)
+// jusqu'a ce que plus rien ne change
+// ---------------------------------------------------------------------------
+
+#define MOTS 4 // 4 x 64 = 256 sources par lot (la boucle sur les mots se vectorise)
+#define SOURCES_PAR_LOT (64 * MOTS)
+
+// lot d'au plus SOURCES_PAR_LOT sources, masques: G->n * MOTS mots
+void accessibilite_lot(Graphe *G, int *sources, int nb, uint64_t *masques) {
+    int n = G->n;
+    memset(masques, 0, (size_t)n * MOTS * sizeof(uint64_t));
+    int *file = (int *)malloc(n * sizeof(int)); // file circulaire, chaque sommet au plus une fois
+    bool *dans_file = (bool *)calloc(n, sizeof(bool));
+    int tete = 0, nb_file = 0;
+
+    for (int k = 0; k < nb; k++) {
+        int s = sources[k];
+        masques[(size_t)s * MOTS + k / 64] |= (uint64_t)1 << (k % 64); // une source s'atteint elle meme
+        if (!dans_file[s]) {
+            dans_file[s] = true;
+            file[(tete + nb_file++) % n] = s;
+        }
+    }
+
+    while (nb_file > 0) {
+        int u = file[tete];
+        tete = (tete + 1) % n;
+        nb_file--;
+        dans_file[u] = false;
+        uint64_t *mu = &masques[(size_t)u * MOTS];
+        Noeud *current = G->listes[u];
+        while (current != NULL) {
+            int v = current->s.id;
+            uint64_t *mv = &masques[(size_t)v * MOTS];
+            uint64_t change = 0;
+            for (int w = 0; w < MOTS; w++) { // v recoit toutes les sources qui atteignent u
+                uint64_t nouveau = mv[w] | mu[w];
+                change |= nouveau ^ mv[w];
+                mv[w] = nouveau;
+            }
+            if (change != 0 && !dans_file[v]) {
+                dans_file[v] = true;
+                file[(tete + nb_file++) % n] = v;
+            }
+            current = current->suivant;
+        }
+    }
+    free(file);
+    free(dans_file);
+}
+
+// true si v est accessible depuis la k-ieme source du lot
+bool est_accessible(uint64_t *masques, int k, int v) {
+    return (masques[(size_t)v * MOTS + k / 64] >> (k % 64)) & 1;
+}
+
+// nombre de sommets accessibles depuis chaque source (source comprise),
+// les sources sont traitees par lots de SOURCES_PAR_LOT
+void nb_accessibles(Graphe *G, int *sources, int nb, int *compte) {
+    uint64_t *masques = (uint64_t *)malloc((size_t)G->n * MOTS * sizeof(uint64_t));
+    for (int debut = 0; debut < nb; debut += SOURCES_PAR_LOT) {
+        int taille = nb - debut < SOURCES_PAR_LOT ? nb - debut : SOURCES_PAR_LOT;
+        accessibilite_lot(G, sources + debut, taille, masques);
+        for (int k = 0; k < taille; k++) {
+            compte[debut + k] = 0;
+        }
+        for (int v = 0; v < G->n; v++) { // un passage sur les masques pour tout le lot
+            uint64_t *mv = &masques[(size_t)v * MOTS];
+            for (int w = 0; w < MOTS; w++) {
+                uint64_t bits = mv[w];
+                while (bits != 0) {
+                    int b = __builtin_ctzll(bits); // bit a 1 le plus faible
+                    compte[debut + w * 64 + b]++;
+                    bits &= bits - 1;
+                }
+            }
+        }
+    }
+    free(masques);
+}
+
+int main(){
+    Graphe g;
+    charge(&g, "mon_graphe.txt");
+    afficher_simple(&g);
+
+    printf("\nEntrer nombre de sources: ");
+    int nb;
+    scanf("%d", &nb);
+    if (nb <= 0) {
+        liberer_graphe(&g);
+        return 0;
+    }
+    int *sources = (int *)malloc(nb * sizeof(int));
+    printf("Entrer les sources: ");
+    for (int k = 0; k < nb; k++) {
+        scanf("%d", &sources[k]);
+        if (sources[k] < 0 || sources[k] >= g.n) {
+            printf("Sommet invalide\n");
+            free(sources);
+            liberer_graphe(&g);
+            return 1;
+        }
+    }
+
+    int *compte = (int *)malloc(nb * sizeof(int));
+    nb_accessibles(&g, sources, nb, compte);
+
+    // liste des sommets accessibles pour le premier lot
+    uint64_t *masques = (uint64_t *)malloc((size_t)g.n * MOTS * sizeof(uint64_t));
+    int taille = nb < SOURCES_PAR_LOT ? nb : SOURCES_PAR_LOT;
+    accessibilite_lot(&g, sources, taille, masques);
+    for (int k = 0; k < nb; k++) {
+        printf("Source %d: %d sommets accessibles", sources[k], compte[k]);
+        if (k < taille) {
+            printf(" :");
+            for (int v = 0; v < g.n; v++) {
+                if (est_accessible(masques, k, v)) {
+                    printf(" %d", v);
+                }
+            }
+        }
+        printf("\n");
+    }
+
+    free(masques);
+    free(compte);
+    free(sources);
+    liberer_graphe(&g);
+    return 0;
+}
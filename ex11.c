@@ -0,0 +1,618 @@
+// sommets identifies par des ids externes de 64 bits, quelconques et pas contigus:
+// un dictionnaire (table de hachage, remplie en parallele au chargement) donne l'indice
+// interne 0..n-1 de chaque id, et on retraduit en ids externes pour l'affichage et le fichier.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+
+//A chaque sommet on associe un identifiant entier (indice interne)
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// table de hachage id externe -> indice interne
+typedef struct {
+    uint64_t *cles; // ids externes, VIDE si case libre
+    int *valeurs; // indices internes
+    size_t capacite; // puissance de 2
+    size_t nb; // nombre de cles
+} Dictionnaire;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int64_t m; // nombre d'aretes (arcs), 64 bits
+    int capacite; // taille allouee de listes et ids
+    Liste *listes; // tableau de n listes
+    uint64_t *ids; // ids[i] = id externe du sommet i
+    Dictionnaire dico; // id externe -> i
+} Graphe;
+
+// ---------------------------------------------------------------------------
+// dictionnaire id externe (64 bits) -> indice interne (0..n-1)
+// table de hachage a adressage ouvert (sondage lineaire), capacite = puissance de 2
+// la cle VIDE (UINT64_MAX) marque une case libre, elle ne peut pas etre un id
+// ---------------------------------------------------------------------------
+
+#define VIDE UINT64_MAX
+#define MAX_THREADS 64
+
+// melange des bits (finaliseur de splitmix64): des ids proches tombent loin dans la table
+static inline uint64_t hacher(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+void dico_init(Dictionnaire *d, size_t capacite_min) {
+    size_t capacite = 16;
+    while (capacite < capacite_min) {
+        capacite *= 2;
+    }
+    d->capacite = capacite;
+    d->nb = 0;
+    d->cles = (uint64_t *)malloc(capacite * sizeof(uint64_t));
+    d->valeurs = (int *)malloc(capacite * sizeof(int));
+    for (size_t i = 0; i < capacite; i++) {
+        d->cles[i] = VIDE;
+    }
+}
+
+void dico_liberer(Dictionnaire *d) {
+    free(d->cles);
+    free(d->valeurs);
+}
+
+// indice interne de l'id externe cle, -1 si absent
+int dico_chercher(Dictionnaire *d, uint64_t cle) {
+    size_t masque = d->capacite - 1;
+    size_t h = hacher(cle) & masque;
+    while (d->cles[h] != VIDE) {
+        if (d->cles[h] == cle) {
+            return d->valeurs[h];
+        }
+        h = (h + 1) & masque;
+    }
+    return -1;
+}
+
+// insertion simple (un seul thread), la table double quand elle est a moitie pleine
+void dico_ajouter(Dictionnaire *d, uint64_t cle, int valeur) {
+    if (2 * (d->nb + 1) > d->capacite) {
+        Dictionnaire nouveau;
+        dico_init(&nouveau, 2 * d->capacite);
+        for (size_t i = 0; i < d->capacite; i++) {
+            if (d->cles[i] != VIDE) {
+                dico_ajouter(&nouveau, d->cles[i], d->valeurs[i]);
+            }
+        }
+        dico_liberer(d);
+        *d = nouveau;
+    }
+    size_t masque = d->capacite - 1;
+    size_t h = hacher(cle) & masque;
+    while (d->cles[h] != VIDE && d->cles[h] != cle) {
+        h = (h + 1) & masque;
+    }
+    if (d->cles[h] == VIDE) {
+        d->nb++;
+    }
+    d->cles[h] = cle;
+    d->valeurs[h] = valeur;
+}
+
+// insertion de la cle seulement, plusieurs threads en meme temps:
+// une case libre est prise par compare-and-swap, si un autre thread l'a prise avant
+// on regarde s'il a mis la meme cle, sinon on continue le sondage
+// (la table doit etre assez grande, pas d'agrandissement ici)
+void dico_inserer_cle_atomique(Dictionnaire *d, uint64_t cle) {
+    size_t masque = d->capacite - 1;
+    size_t h = hacher(cle) & masque;
+    while (true) {
+        uint64_t actuelle = __atomic_load_n(&d->cles[h], __ATOMIC_RELAXED);
+        if (actuelle == cle) {
+            return;
+        }
+        if (actuelle == VIDE) {
+            uint64_t attendu = VIDE;
+            if (__atomic_compare_exchange_n(&d->cles[h], &attendu, cle, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                return;
+            }
+            if (attendu == cle) {
+                return;
+            }
+        }
+        h = (h + 1) & masque;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// graphe avec ids externes
+// ---------------------------------------------------------------------------
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->capacite = n > 0 ? n : 1;
+    g->listes = (Liste *)malloc(g->capacite * sizeof(Liste)); // allocation dynamique
+    g->ids = (uint64_t *)malloc(g->capacite * sizeof(uint64_t));
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+        g->ids[i] = i;
+    }
+    dico_init(&g->dico, 2 * (size_t)g->capacite);
+    for (int i = 0; i < n; i++) {
+        dico_ajouter(&g->dico, (uint64_t)i, i);
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets (indices internes)
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1];
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+// ajout_lien sur les indices internes
+void ajout_lien_interne(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+}
+
+// indice interne de l'id externe, le sommet est cree s'il n'existe pas
+int ajout_sommet(Graphe *g, uint64_t id){
+    int i = dico_chercher(&g->dico, id);
+    if (i != -1) {
+        return i; // le sommet existe deja
+    }
+    if (g->n == g->capacite) { // doubler au lieu d'un realloc par sommet
+        g->capacite *= 2;
+        g->listes = (Liste *)realloc(g->listes, g->capacite * sizeof(Liste));
+        g->ids = (uint64_t *)realloc(g->ids, g->capacite * sizeof(uint64_t));
+    }
+    i = g->n++;
+    g->listes[i] = NULL;
+    g->ids[i] = id;
+    dico_ajouter(&g->dico, id, i);
+    return i;
+}
+
+// ajout_lien avec des ids externes quelconques (64 bits, pas forcement contigus)
+void ajout_lien(Graphe *g, uint64_t id1, uint64_t id2) {
+    if (id1 == VIDE || id2 == VIDE) {
+        printf("Id invalide\n");
+        return;
+    }
+    int i = ajout_sommet(g, id1);
+    int j = ajout_sommet(g, id2);
+    if (lien_existe(g, i, j)) {
+        printf("Le lien existe deja\n");
+        return;
+    }
+    ajout_lien_interne(g, i, j);
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+    free(g->ids);
+    dico_liberer(&g->dico);
+}
+
+// ---------------------------------------------------------------------------
+// chargement: meme format que charge ("oriente n m" puis "id1 id2"), mais les ids sont
+// des entiers 64 bits quelconques et n de l'entete est ignore
+// section optionnelle apres les m liens: "k" puis k ids de sommets isoles (sans lien),
+// sinon ils seraient perdus; charge de ex1 lit exactement m liens et l'ignore
+// 1. lecture des liens puis des sommets isoles en ids externes
+// 2. insertion des ids dans le dictionnaire par nb_threads threads (compare-and-swap)
+// 3. indices internes = rang de l'id trie (meme resultat quel que soit l'ordre des threads)
+// 4. traduction des liens en indices internes par les threads, puis ajout dans les listes
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    Dictionnaire *dico;
+    uint64_t *liens; // 2 ids externes par lien
+    int *internes; // sortie de l'etape 4
+    int64_t debut, fin; // plage dans liens (en nombre d'ids)
+} TravailDico;
+
+void *thread_inserer(void *arg) {
+    TravailDico *w = (TravailDico *)arg;
+    for (int64_t k = w->debut; k < w->fin; k++) {
+        dico_inserer_cle_atomique(w->dico, w->liens[k]);
+    }
+    return NULL;
+}
+
+void *thread_traduire(void *arg) {
+    TravailDico *w = (TravailDico *)arg;
+    for (int64_t k = w->debut; k < w->fin; k++) {
+        w->internes[k] = dico_chercher(w->dico, w->liens[k]);
+    }
+    return NULL;
+}
+
+// lance fonction sur nb_threads plages de [0, total)
+void lancer_threads(void *(*fonction)(void *), TravailDico *modele, int64_t total, int nb_threads) {
+    pthread_t threads[MAX_THREADS];
+    TravailDico travaux[MAX_THREADS];
+    for (int t = 0; t < nb_threads; t++) {
+        travaux[t] = *modele;
+        travaux[t].debut = total * t / nb_threads;
+        travaux[t].fin = total * (t + 1) / nb_threads;
+        pthread_create(&threads[t], NULL, fonction, &travaux[t]);
+    }
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+}
+
+int comparer_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// lit un entier non signe de 64 bits a la main (pas de locale), separe par des blancs
+// retourne 1 si un entier est lu, 0 a la fin du fichier, -1 si le texte contient autre
+// chose que des chiffres et des blancs (par ex. un id negatif) ou un entier trop grand
+int lire_u64(FILE *fichier, uint64_t *x) {
+    int c = fgetc(fichier);
+    while (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        c = fgetc(fichier);
+    }
+    if (c == EOF) {
+        return 0;
+    }
+    if (c < '0' || c > '9') {
+        return -1;
+    }
+    uint64_t v = 0;
+    while (c >= '0' && c <= '9') {
+        unsigned chiffre = c - '0';
+        if (v > (UINT64_MAX - chiffre) / 10) { // depassement
+            return -1;
+        }
+        v = v * 10 + chiffre;
+        c = fgetc(fichier);
+    }
+    if (c != EOF && c != ' ' && c != '\t' && c != '\r' && c != '\n') { // ex. "5-7"
+        return -1;
+    }
+    *x = v;
+    return 1;
+}
+
+// ajoute id a la fin de *liens, le tableau double quand il est plein: sa taille suit ce
+// qui est vraiment lu, pas l'entete du fichier; false si la memoire manque
+bool ajouter_id(uint64_t **liens, int64_t *capacite, int64_t *nb, uint64_t id) {
+    if (*nb == *capacite) {
+        if (*capacite > (int64_t)(SIZE_MAX / (2 * sizeof(uint64_t)))) {
+            return false;
+        }
+        uint64_t *nouveau = (uint64_t *)realloc(*liens, 2 * *capacite * sizeof(uint64_t));
+        if (nouveau == NULL) {
+            return false;
+        }
+        *liens = nouveau;
+        *capacite *= 2;
+    }
+    (*liens)[(*nb)++] = id;
+    return true;
+}
+
+// retourne false si le fichier est invalide: g est alors un graphe vide
+bool charge(Graphe *g, const char *nom_fichier, int nb_threads){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        init_graphe(g, 0, false);
+        return false;
+    }
+    uint64_t oriente, n, m;
+    if (lire_u64(fichier, &oriente) != 1 || lire_u64(fichier, &n) != 1 || lire_u64(fichier, &m) != 1 || oriente > 1) {
+        printf("Erreur: entete invalide\n");
+        fclose(fichier);
+        init_graphe(g, 0, false);
+        return false;
+    }
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+
+    // 1. liens en ids externes, puis les sommets isoles a la suite dans liens
+    int64_t capacite = 1024;
+    uint64_t *liens = (uint64_t *)malloc(capacite * sizeof(uint64_t));
+    int64_t nb_ids = 0;
+    uint64_t id;
+    int lu = 1; // dernier retour de lire_u64, -1: fichier invalide
+    bool memoire = liens != NULL;
+    while (memoire && (uint64_t)nb_ids / 2 < m && (lu = lire_u64(fichier, &id)) == 1) {
+        if (id == VIDE) {
+            lu = -1;
+            break;
+        }
+        memoire = ajouter_id(&liens, &capacite, &nb_ids, id);
+    }
+    nb_ids -= nb_ids % 2; // fichier tronque: dernier lien incomplet ignore
+    int64_t nb_total = nb_ids; // liens + sommets isoles
+    uint64_t nb_isoles;
+    if (memoire && lu == 1 && (uint64_t)nb_ids / 2 == m && (lu = lire_u64(fichier, &nb_isoles)) == 1) {
+        for (uint64_t k = 0; memoire && k < nb_isoles && (lu = lire_u64(fichier, &id)) == 1; k++) {
+            if (id == VIDE) {
+                lu = -1;
+                break;
+            }
+            memoire = ajouter_id(&liens, &capacite, &nb_total, id);
+        }
+    }
+    fclose(fichier);
+    if (!memoire || lu < 0) {
+        printf(memoire ? "Erreur: id invalide ou trop grand\n" : "Erreur: memoire insuffisante\n");
+        free(liens);
+        init_graphe(g, 0, false);
+        return false;
+    }
+
+    // 2. dictionnaire rempli en parallele (capacite >= 2 x nombre d'ids: jamais plein)
+    Dictionnaire dico;
+    dico_init(&dico, 2 * (size_t)nb_total);
+    TravailDico modele = {&dico, liens, NULL, 0, 0};
+    lancer_threads(thread_inserer, &modele, nb_total, nb_threads);
+
+    // 3. indices internes dans l'ordre croissant des ids
+    int64_t nb_sommets = 0;
+    for (size_t h = 0; h < dico.capacite; h++) {
+        if (dico.cles[h] != VIDE) {
+            nb_sommets++;
+        }
+    }
+    if (nb_sommets > INT_MAX) { // indices internes en int
+        printf("Erreur: trop de sommets\n");
+        dico_liberer(&dico);
+        free(liens);
+        init_graphe(g, 0, false);
+        return false;
+    }
+    uint64_t *tries = (uint64_t *)malloc((nb_sommets + 1) * sizeof(uint64_t));
+    nb_sommets = 0;
+    for (size_t h = 0; h < dico.capacite; h++) {
+        if (dico.cles[h] != VIDE) {
+            tries[nb_sommets++] = dico.cles[h];
+        }
+    }
+    qsort(tries, nb_sommets, sizeof(uint64_t), comparer_u64);
+
+    init_graphe(g, 0, oriente);
+    dico_liberer(&g->dico);
+    g->capacite = nb_sommets > 0 ? nb_sommets : 1;
+    g->listes = (Liste *)realloc(g->listes, g->capacite * sizeof(Liste));
+    free(g->ids);
+    g->ids = tries; // ids[i] = id externe du sommet i
+    g->n = (int)nb_sommets;
+    for (int i = 0; i < g->n; i++) {
+        g->listes[i] = NULL;
+    }
+    dico.nb = nb_sommets;
+    for (size_t h = 0; h < dico.capacite; h++) { // valeur = rang de la cle
+        if (dico.cles[h] != VIDE) {
+            uint64_t *trouve = (uint64_t *)bsearch(&dico.cles[h], tries, nb_sommets, sizeof(uint64_t), comparer_u64);
+            dico.valeurs[h] = (int)(trouve - tries);
+        }
+    }
+    g->dico = dico;
+
+    // 4. traduction en parallele puis ajout dans les listes (dans l'ordre du fichier)
+    int *internes = (int *)malloc((nb_ids + 1) * sizeof(int));
+    modele.internes = internes;
+    lancer_threads(thread_traduire, &modele, nb_ids, nb_threads);
+    for (int64_t k = 0; k < nb_ids; k += 2) {
+        ajout_lien_interne(g, internes[k], internes[k + 1]);
+    }
+    free(internes);
+    free(liens);
+    return true;
+}
+
+// le fichier garde les ids externes, les sommets sans aucun lien sont ecrits a la fin
+void sauvegarder(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "w");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    fprintf(fichier, "%d %d %" PRId64 "\n", g->oriente, g->n, g->m);
+    for (int i = 0; i < g->n; i++) {
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            if (g->oriente || i <= current->s.id) { // prevent duplication in non or graph
+                fprintf(fichier, "%" PRIu64 " %" PRIu64 "\n", g->ids[i], g->ids[current->s.id]);
+            }
+            current = current->suivant;
+        }
+    }
+
+    // sommets isoles: ni successeur ni predecesseur
+    bool *relie = (bool *)calloc(g->n + 1, sizeof(bool));
+    for (int i = 0; i < g->n; i++) {
+        for (Noeud *current = g->listes[i]; current != NULL; current = current->suivant) {
+            relie[i] = true;
+            relie[current->s.id] = true;
+        }
+    }
+    int nb_isoles = 0;
+    for (int i = 0; i < g->n; i++) {
+        if (!relie[i]) {
+            nb_isoles++;
+        }
+    }
+    if (nb_isoles > 0) {
+        fprintf(fichier, "%d\n", nb_isoles);
+        for (int i = 0; i < g->n; i++) {
+            if (!relie[i]) {
+                fprintf(fichier, "%" PRIu64 "\n", g->ids[i]);
+            }
+        }
+    }
+    free(relie);
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %" PRId64 "\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %" PRIu64 ": ", g->ids[i]);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%" PRIu64 " -> ", g->ids[current->s.id]);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+// DFS: Depth First Search (sur les indices internes)
+// blanc: sommet non découvert
+// gris: sommet découvert mais pas encore traité
+// noir: sommet traité
+void DFS_visit(Graphe *G, int u, int *d, int *f, int *p, int *time, int *color) {
+    color[u] = 1; // set color de 0 = gris
+    d[u] = ++(*time); // increment temp decouverte
+    Noeud *current = G->listes[u];
+    while (current != NULL) {
+        int v = current->s.id;
+        if (color[v] == 0) { // blanc
+            p[v] = u; // predecesseur de v est u
+            DFS_visit(G, v, d, f, p, time, color); // recursive avec des sommets adjacents de v
+        }
+        current = current->suivant;
+    }
+    color[u] = 2; // noir (fin de traitement)
+    f[u] = ++(*time); // increment temp fin
+}
+
+void parcours(Graphe *G, int id, int *d, int *f, int *p) {
+    int *color = (int *)malloc(G->n * sizeof(int)); // 0: blanc, 1: gris, 2: noir
+    for (int i = 0; i < G->n; i++) {
+        color[i] = 0; // initialiser tous les sommets à blanc
+        p[i] = -1; // initialiser tous les predecesseurs à -1
+    }
+    int time = 0;
+    DFS_visit(G, id, d, f, p, &time, color);
+    free(color);
+}
+
+// d, f, p sont indexes par indice interne, l'affichage est en ids externes
+void afficher_parcours(Graphe *G, int id, int *d, int *f, int *p) {
+    printf("Sommet\tDecouverte\tFin\tPredecesseur\n");
+    for (int i = 0; i < G->n; i++) {
+        if(i != id && p[i] == -1) continue; // si sommet n'est pas accessible
+        printf("%" PRIu64 "\t%d\t\t%d\t", G->ids[i], d[i], f[i]);
+        if (p[i] == -1) {
+            printf("-1\n");
+        } else {
+            printf("%" PRIu64 "\n", G->ids[p[i]]);
+        }
+    }
+}
+
+int main(){
+    printf("Nombre de threads: ");
+    int nb_threads;
+    scanf("%d", &nb_threads);
+
+    Graphe g;
+    if (!charge(&g, "mon_graphe.txt", nb_threads)) {
+        liberer_graphe(&g);
+        return 1;
+    }
+
+    // ids tres grands et pas contigus: pas de tableau de taille id
+    ajout_lien(&g, 0, 9000000000000000000ULL);
+    ajout_lien(&g, 9000000000000000000ULL, 18000000000000000000ULL);
+    afficher_simple(&g);
+
+    printf("\nEntrer sommet source (id externe): ");
+    uint64_t source;
+    scanf("%" SCNu64, &source);
+    int id = dico_chercher(&g.dico, source);
+    if (id == -1) {
+        printf("Le sommet n'existe pas\n");
+    } else {
+        int *d = (int *)malloc(g.n * sizeof(int));
+        int *f = (int *)malloc(g.n * sizeof(int));
+        int *p = (int *)malloc(g.n * sizeof(int));
+        parcours(&g, id, d, f, p);
+        afficher_parcours(&g, id, d, f, p);
+        free(d);
+        free(f);
+        free(p);
+    }
+
+    sauvegarder(&g, "mon_graphe_ids.txt");
+    liberer_graphe(&g);
+    return 0;
+}
@@ -0,0 +1,731 @@
+// serveur de requetes sur un graphe: on charge le graphe une seule fois puis on repond
+// aux clients de la meme machine (socket Unix) sur l'adjacence, les degres, les sommets
+// accessibles (DFS/BFS) et les composantes, avec un pool de threads et des requetes en lot.
+// le thread principal surveille toutes les connexions (poll) et ne donne aux workers que
+// des lots de requetes complets: un client inactif n'occupe aucun worker.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void degres(Graphe *g, int *de, int *dg){
+    for(int i = 0; i < g->n; i++){ // pour chaque sommet
+        dg[i] = longueur_liste(g->listes[i]); // degre sortant
+        de[i] = 0;
+    }
+    if (g->oriente) {
+        for (int i = 0; i < g->n; i++) {
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                de[current->s.id]++;
+                current = current->suivant;
+            }
+        }
+    } else {
+        for (int i = 0; i < g->n; i++) {
+            de[i] = dg[i]; // pour un graphe non orienté, degré entrant = degré sortant
+        }
+    }
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    if (fscanf(fichier, "%d %d %d", &oriente, &n, &m) != 3) {
+        printf("Erreur: entete invalide\n");
+        fclose(fichier);
+        return;
+    }
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+// ---------------------------------------------------------------------------
+// protocole (entiers 32 bits, ordre des octets de la machine: client et serveur sur
+// la meme machine)
+// requete: 3 entiers {op, u, v}
+// reponse: 2 entiers {statut, nb} puis nb entiers
+// le client peut envoyer plusieurs requetes sans attendre (pipeline): le serveur traite
+// toutes les requetes completes recues d'un coup et renvoie les reponses dans l'ordre
+// en une seule ecriture
+// ---------------------------------------------------------------------------
+
+enum {
+    OP_INFO = 0, // -> {oriente, n, m}
+    OP_ADJACENT = 1, // lien u -> v ? -> {0 ou 1}
+    OP_VOISINS = 2, // -> voisins de u
+    OP_DEGRE = 3, // -> {degre entrant, degre sortant}
+    OP_DFS = 4, // -> sommets accessibles depuis u, ordre du parcours en profondeur
+    OP_BFS = 5, // -> sommets accessibles depuis u, ordre du parcours en largeur
+    OP_COMPOSANTE = 6, // -> {composante de u}
+    OP_CONNECTES = 7 // u et v dans la meme composante ? -> {0 ou 1}
+};
+
+enum { OK = 0, SOMMET_INVALIDE = 1, OP_INCONNUE = 2 };
+
+typedef struct {
+    int32_t op;
+    int32_t u;
+    int32_t v;
+} Requete;
+
+#define MAX_THREADS 64
+#define TAILLE_LECTURE (64 * 1024)
+#define MAX_ATTENTE 1024 // lots en attente d'un worker
+#define FENETRE 256 // requetes envoyees par le client avant de lire les reponses
+
+// donnees partagees, en lecture seule apres le chargement
+typedef struct {
+    Graphe *g;
+    int *de, *dg; // degres precalcules
+    int *composante; // composante de chaque sommet
+} Index;
+
+// memoire propre a un worker, reutilisee d'une requete a l'autre
+typedef struct {
+    Index *index;
+    int *marque; // marque[v] == epoque: v deja visite dans la requete courante
+    int epoque;
+    int *pile; // pile (DFS) ou file (BFS)
+    Noeud **position; // DFS: prochain voisin a regarder pour chaque sommet de la pile
+    int32_t *sortie; // tampon de reponse
+    size_t taille_sortie, capacite_sortie;
+} Worker;
+
+// une connexion cliente
+// occupe: un lot est chez un worker, seul ce worker touche alors a entree et le thread
+// principal ne lit plus la socket (les reponses restent dans l'ordre des requetes)
+typedef struct {
+    int fd;
+    char *entree; // octets recus, dont au plus une requete incomplete a la fin
+    size_t dans_tampon;
+    bool occupe; // protege par le verrou de la file
+    bool erreur; // ecriture impossible: a fermer
+} Connexion;
+
+// file des connexions ayant un lot de requetes complet a traiter
+typedef struct {
+    Connexion *connexions[MAX_ATTENTE];
+    int tete, nb;
+    pthread_mutex_t verrou;
+    pthread_cond_t non_vide;
+    pthread_cond_t non_plein;
+    int reveil; // un worker y ecrit un octet quand il rend une connexion au thread principal
+} FileConnexions;
+
+typedef struct {
+    Worker w;
+    FileConnexions *file;
+} ArgWorker;
+
+// composantes comme dans composantes (meme numerotation), mais sans recursion:
+// le serveur doit tenir des graphes trop profonds pour la pile d'appels
+void calcul_composantes(Graphe *G, int *c) {
+    int *pile = (int *)malloc(G->n * sizeof(int));
+    for (int i = 0; i < G->n; i++) {
+        c[i] = -1;
+    }
+    int component_id = 0;
+    for (int i = 0; i < G->n; i++) {
+        if (c[i] != -1) {
+            continue;
+        }
+        int sommet_pile = 0;
+        pile[sommet_pile++] = i;
+        c[i] = component_id;
+        while (sommet_pile > 0) {
+            int u = pile[--sommet_pile];
+            for (Noeud *current = G->listes[u]; current != NULL; current = current->suivant) {
+                if (c[current->s.id] == -1) {
+                    c[current->s.id] = component_id;
+                    pile[sommet_pile++] = current->s.id;
+                }
+            }
+        }
+        component_id++;
+    }
+    free(pile);
+}
+
+void init_index(Index *index, Graphe *g) {
+    index->g = g;
+    index->de = (int *)malloc(g->n * sizeof(int));
+    index->dg = (int *)malloc(g->n * sizeof(int));
+    index->composante = (int *)malloc(g->n * sizeof(int));
+    degres(g, index->de, index->dg);
+    calcul_composantes(g, index->composante);
+}
+
+void liberer_index(Index *index) {
+    free(index->de);
+    free(index->dg);
+    free(index->composante);
+}
+
+void init_worker(Worker *w, Index *index) {
+    int n = index->g->n;
+    w->index = index;
+    w->marque = (int *)calloc(n, sizeof(int));
+    w->epoque = 0;
+    w->pile = (int *)malloc(n * sizeof(int));
+    w->position = (Noeud **)malloc(n * sizeof(Noeud *));
+    w->capacite_sortie = 1024;
+    w->sortie = (int32_t *)malloc(w->capacite_sortie * sizeof(int32_t));
+    w->taille_sortie = 0;
+}
+
+void liberer_worker(Worker *w) {
+    free(w->marque);
+    free(w->pile);
+    free(w->position);
+    free(w->sortie);
+}
+
+void ecrire_sortie(Worker *w, int32_t x) {
+    if (w->taille_sortie == w->capacite_sortie) {
+        w->capacite_sortie *= 2;
+        w->sortie = (int32_t *)realloc(w->sortie, w->capacite_sortie * sizeof(int32_t));
+    }
+    w->sortie[w->taille_sortie++] = x;
+}
+
+// nouvelle epoque = tous les sommets redeviennent blancs sans reinitialiser le tableau
+void nouvelle_epoque(Worker *w) {
+    w->epoque++;
+    if (w->epoque == 0) { // tour complet du compteur: on remet a zero pour de vrai
+        memset(w->marque, 0, w->index->g->n * sizeof(int));
+        w->epoque = 1;
+    }
+}
+
+// ajoute la reponse a la requete r dans le tampon de sortie
+void traiter_requete(Worker *w, Requete *r) {
+    Graphe *g = w->index->g;
+    size_t entete = w->taille_sortie;
+    ecrire_sortie(w, OK);
+    ecrire_sortie(w, 0); // nb, rempli a la fin
+    bool besoin_u = r->op != OP_INFO;
+    bool besoin_v = r->op == OP_ADJACENT || r->op == OP_CONNECTES;
+    if ((besoin_u && (r->u < 0 || r->u >= g->n)) || (besoin_v && (r->v < 0 || r->v >= g->n))) {
+        w->sortie[entete] = SOMMET_INVALIDE;
+        return;
+    }
+    switch (r->op) {
+    case OP_INFO:
+        ecrire_sortie(w, g->oriente);
+        ecrire_sortie(w, g->n);
+        ecrire_sortie(w, g->m);
+        break;
+    case OP_ADJACENT:
+        ecrire_sortie(w, lien_existe(g, r->u, r->v));
+        break;
+    case OP_VOISINS:
+        for (Noeud *current = g->listes[r->u]; current != NULL; current = current->suivant) {
+            ecrire_sortie(w, current->s.id);
+        }
+        break;
+    case OP_DEGRE:
+        ecrire_sortie(w, w->index->de[r->u]);
+        ecrire_sortie(w, w->index->dg[r->u]);
+        break;
+    case OP_DFS: { // meme ordre de decouverte que DFS_visit, avec une pile explicite
+        nouvelle_epoque(w);
+        int sommet_pile = 0;
+        w->pile[sommet_pile] = r->u;
+        w->position[sommet_pile] = g->listes[r->u];
+        sommet_pile++;
+        w->marque[r->u] = w->epoque;
+        ecrire_sortie(w, r->u);
+        while (sommet_pile > 0) {
+            Noeud *current = w->position[sommet_pile - 1];
+            while (current != NULL && w->marque[current->s.id] == w->epoque) {
+                current = current->suivant;
+            }
+            if (current == NULL) { // u noir
+                sommet_pile--;
+                continue;
+            }
+            w->position[sommet_pile - 1] = current->suivant;
+            int v = current->s.id;
+            w->marque[v] = w->epoque;
+            ecrire_sortie(w, v);
+            w->pile[sommet_pile] = v;
+            w->position[sommet_pile] = g->listes[v];
+            sommet_pile++;
+        }
+        break;
+    }
+    case OP_BFS: {
+        nouvelle_epoque(w);
+        int tete = 0, fin = 0;
+        w->pile[fin++] = r->u;
+        w->marque[r->u] = w->epoque;
+        while (tete < fin) {
+            int u = w->pile[tete++];
+            ecrire_sortie(w, u);
+            for (Noeud *current = g->listes[u]; current != NULL; current = current->suivant) {
+                if (w->marque[current->s.id] != w->epoque) {
+                    w->marque[current->s.id] = w->epoque;
+                    w->pile[fin++] = current->s.id;
+                }
+            }
+        }
+        break;
+    }
+    case OP_COMPOSANTE:
+        ecrire_sortie(w, w->index->composante[r->u]);
+        break;
+    case OP_CONNECTES:
+        ecrire_sortie(w, w->index->composante[r->u] == w->index->composante[r->v]);
+        break;
+    default:
+        w->sortie[entete] = OP_INCONNUE;
+        break;
+    }
+    w->sortie[entete + 1] = (int32_t)(w->taille_sortie - entete - 2);
+}
+
+// ecrit tout le tampon (write peut ecrire moins que demande)
+bool ecrire_tout(int fd, const void *buf, size_t taille) {
+    const char *p = (const char *)buf;
+    while (taille > 0) {
+        ssize_t k = write(fd, p, taille);
+        if (k <= 0) {
+            return false;
+        }
+        p += k;
+        taille -= k;
+    }
+    return true;
+}
+
+// traite toutes les requetes completes recues sur c et renvoie les reponses en une ecriture
+void traiter_lot(Worker *w, Connexion *c) {
+    size_t nb_requetes = c->dans_tampon / sizeof(Requete);
+    w->taille_sortie = 0;
+    for (size_t k = 0; k < nb_requetes; k++) { // tout le lot d'un coup
+        Requete r;
+        memcpy(&r, c->entree + k * sizeof(Requete), sizeof(Requete));
+        traiter_requete(w, &r);
+    }
+    size_t consommes = nb_requetes * sizeof(Requete);
+    memmove(c->entree, c->entree + consommes, c->dans_tampon - consommes); // requete incomplete
+    c->dans_tampon -= consommes;
+    if (!ecrire_tout(c->fd, w->sortie, w->taille_sortie * sizeof(int32_t))) {
+        c->erreur = true;
+    }
+}
+
+void *thread_worker(void *arg) {
+    ArgWorker *a = (ArgWorker *)arg;
+    FileConnexions *file = a->file;
+    while (true) {
+        pthread_mutex_lock(&file->verrou);
+        while (file->nb == 0) {
+            pthread_cond_wait(&file->non_vide, &file->verrou);
+        }
+        Connexion *c = file->connexions[file->tete];
+        file->tete = (file->tete + 1) % MAX_ATTENTE;
+        file->nb--;
+        pthread_cond_signal(&file->non_plein);
+        pthread_mutex_unlock(&file->verrou);
+
+        traiter_lot(&a->w, c);
+
+        pthread_mutex_lock(&file->verrou);
+        c->occupe = false; // la connexion revient au thread principal
+        pthread_mutex_unlock(&file->verrou);
+        char octet = 0;
+        if (write(file->reveil, &octet, 1) < 0) {
+            // tube plein: un reveil est deja en attente
+        }
+    }
+    return NULL;
+}
+
+void fermer_connexion(Connexion *c) {
+    close(c->fd);
+    free(c->entree);
+    free(c);
+}
+
+// charge le graphe une seule fois puis repond aux clients sur la socket chemin
+int serveur(const char *nom_fichier, const char *chemin, int nb_threads) {
+    Graphe g;
+    g.listes = NULL;
+    charge(&g, nom_fichier);
+    if (g.listes == NULL) {
+        return 1;
+    }
+    Index index;
+    init_index(&index, &g);
+    printf("Graphe charge: %d sommets, %d connexions\n", g.n, g.m);
+
+    int ecoute = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un adresse;
+    memset(&adresse, 0, sizeof(adresse));
+    adresse.sun_family = AF_UNIX;
+    strncpy(adresse.sun_path, chemin, sizeof(adresse.sun_path) - 1);
+    unlink(chemin); // ancienne socket d'un serveur precedent
+    if (ecoute < 0 || bind(ecoute, (struct sockaddr *)&adresse, sizeof(adresse)) < 0 || listen(ecoute, 128) < 0) {
+        printf("Erreur: impossible d'ouvrir la socket %s\n", chemin);
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN); // client parti: write retourne une erreur au lieu de tuer le serveur
+
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+    FileConnexions file;
+    file.tete = 0;
+    file.nb = 0;
+    pthread_mutex_init(&file.verrou, NULL);
+    pthread_cond_init(&file.non_vide, NULL);
+    pthread_cond_init(&file.non_plein, NULL);
+    int tube[2]; // reveil du poll quand un worker rend une connexion
+    if (pipe(tube) < 0) {
+        printf("Erreur: impossible de creer le tube de reveil\n");
+        return 1;
+    }
+    fcntl(tube[0], F_SETFL, O_NONBLOCK);
+    fcntl(tube[1], F_SETFL, O_NONBLOCK);
+    file.reveil = tube[1];
+    ArgWorker args[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    for (int t = 0; t < nb_threads; t++) {
+        init_worker(&args[t].w, &index);
+        args[t].file = &file;
+        pthread_create(&threads[t], NULL, thread_worker, &args[t]);
+    }
+    printf("Serveur pret sur %s avec %d threads\n", chemin, nb_threads);
+    fflush(stdout);
+
+    // boucle d'evenements: on surveille la socket d'ecoute, le tube de reveil et les
+    // connexions qui n'ont pas de lot chez un worker
+    int nb_connexions = 0, capacite = 64;
+    Connexion **connexions = (Connexion **)malloc(capacite * sizeof(Connexion *));
+    struct pollfd *surveilles = (struct pollfd *)malloc((capacite + 2) * sizeof(struct pollfd));
+    Connexion **surveillees = (Connexion **)malloc(capacite * sizeof(Connexion *));
+    while (true) {
+        surveilles[0].fd = ecoute;
+        surveilles[0].events = POLLIN;
+        surveilles[1].fd = tube[0];
+        surveilles[1].events = POLLIN;
+        int nb_surveilles = 2;
+        pthread_mutex_lock(&file.verrou);
+        for (int k = 0; k < nb_connexions; k++) {
+            Connexion *c = connexions[k];
+            if (c->occupe) {
+                continue;
+            }
+            if (c->erreur) { // fermee ici, plus aucun worker ne la connait
+                fermer_connexion(c);
+                connexions[k--] = connexions[--nb_connexions];
+                continue;
+            }
+            surveillees[nb_surveilles - 2] = c;
+            surveilles[nb_surveilles].fd = c->fd;
+            surveilles[nb_surveilles].events = POLLIN;
+            nb_surveilles++;
+        }
+        pthread_mutex_unlock(&file.verrou);
+
+        if (poll(surveilles, nb_surveilles, -1) < 0) {
+            continue;
+        }
+        if (surveilles[1].revents & POLLIN) {
+            char vide[256];
+            while (read(tube[0], vide, sizeof(vide)) > 0) {
+            }
+        }
+        for (int k = 2; k < nb_surveilles; k++) {
+            if (surveilles[k].revents == 0) {
+                continue;
+            }
+            Connexion *c = surveillees[k - 2];
+            ssize_t lus = read(c->fd, c->entree + c->dans_tampon, TAILLE_LECTURE - c->dans_tampon);
+            if (lus <= 0) { // client parti
+                for (int j = 0; j < nb_connexions; j++) {
+                    if (connexions[j] == c) {
+                        connexions[j] = connexions[--nb_connexions];
+                        break;
+                    }
+                }
+                fermer_connexion(c);
+                continue;
+            }
+            c->dans_tampon += lus;
+            if (c->dans_tampon < sizeof(Requete)) {
+                continue;
+            }
+            pthread_mutex_lock(&file.verrou); // lot complet: donne a un worker
+            while (file.nb == MAX_ATTENTE) {
+                pthread_cond_wait(&file.non_plein, &file.verrou);
+            }
+            c->occupe = true;
+            file.connexions[(file.tete + file.nb) % MAX_ATTENTE] = c;
+            file.nb++;
+            pthread_cond_signal(&file.non_vide);
+            pthread_mutex_unlock(&file.verrou);
+        }
+        if (surveilles[0].revents & POLLIN) {
+            int fd = accept(ecoute, NULL, NULL);
+            if (fd >= 0) {
+                if (nb_connexions == capacite) {
+                    capacite *= 2;
+                    connexions = (Connexion **)realloc(connexions, capacite * sizeof(Connexion *));
+                    surveilles = (struct pollfd *)realloc(surveilles, (capacite + 2) * sizeof(struct pollfd));
+                    surveillees = (Connexion **)realloc(surveillees, capacite * sizeof(Connexion *));
+                }
+                Connexion *c = (Connexion *)malloc(sizeof(Connexion));
+                c->fd = fd;
+                c->entree = (char *)malloc(TAILLE_LECTURE);
+                c->dans_tampon = 0;
+                c->occupe = false;
+                c->erreur = false;
+                connexions[nb_connexions++] = c;
+            }
+        }
+    }
+    // jamais atteint: le serveur s'arrete avec un signal
+    liberer_index(&index);
+    liberer_graphe(&g);
+    return 0;
+}
+
+bool lire_tout(int fd, void *buf, size_t taille) {
+    char *p = (char *)buf;
+    while (taille > 0) {
+        ssize_t k = read(fd, p, taille);
+        if (k <= 0) {
+            return false;
+        }
+        p += k;
+        taille -= k;
+    }
+    return true;
+}
+
+// client: lit des commandes sur l'entree standard, les envoie en lot puis affiche les
+// reponses dans l'ordre
+// commandes: i | a u v | v u | d u | p u | l u | c u | q u v
+int client(const char *chemin) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un adresse;
+    memset(&adresse, 0, sizeof(adresse));
+    adresse.sun_family = AF_UNIX;
+    strncpy(adresse.sun_path, chemin, sizeof(adresse.sun_path) - 1);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&adresse, sizeof(adresse)) < 0) {
+        printf("Erreur: pas de serveur sur %s\n", chemin);
+        return 1;
+    }
+
+    int capacite = 64, nb = 0;
+    Requete *requetes = (Requete *)malloc(capacite * sizeof(Requete));
+    char cmd;
+    while (scanf(" %c", &cmd) == 1) {
+        Requete r = {0, 0, 0};
+        switch (cmd) {
+        case 'i': r.op = OP_INFO; break;
+        case 'a': r.op = OP_ADJACENT; scanf("%d %d", &r.u, &r.v); break;
+        case 'v': r.op = OP_VOISINS; scanf("%d", &r.u); break;
+        case 'd': r.op = OP_DEGRE; scanf("%d", &r.u); break;
+        case 'p': r.op = OP_DFS; scanf("%d", &r.u); break;
+        case 'l': r.op = OP_BFS; scanf("%d", &r.u); break;
+        case 'c': r.op = OP_COMPOSANTE; scanf("%d", &r.u); break;
+        case 'q': r.op = OP_CONNECTES; scanf("%d %d", &r.u, &r.v); break;
+        default: printf("Commande inconnue: %c\n", cmd); continue;
+        }
+        if (nb == capacite) {
+            capacite *= 2;
+            requetes = (Requete *)realloc(requetes, capacite * sizeof(Requete));
+        }
+        requetes[nb++] = r;
+    }
+
+    // envoi par fenetres de FENETRE requetes sans attendre les reponses (pipeline),
+    // on lit les reponses d'une fenetre avant d'envoyer la suivante pour que les tampons
+    // de la socket ne se remplissent pas des deux cotes en meme temps
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int32_t **reponses = (int32_t **)malloc((nb + 1) * sizeof(int32_t *));
+    int32_t *entetes = (int32_t *)malloc((2 * nb + 1) * sizeof(int32_t));
+    for (int debut = 0; debut < nb; debut += FENETRE) {
+        int fin = debut + FENETRE < nb ? debut + FENETRE : nb;
+        if (!ecrire_tout(fd, &requetes[debut], (fin - debut) * sizeof(Requete))) {
+            printf("Erreur d'envoi\n");
+            return 1;
+        }
+        for (int k = debut; k < fin; k++) {
+            if (!lire_tout(fd, &entetes[2 * k], 2 * sizeof(int32_t))) {
+                printf("Erreur de reception\n");
+                return 1;
+            }
+            reponses[k] = (int32_t *)malloc((entetes[2 * k + 1] + 1) * sizeof(int32_t));
+            if (!lire_tout(fd, reponses[k], entetes[2 * k + 1] * sizeof(int32_t))) {
+                printf("Erreur de reception\n");
+                return 1;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    close(fd);
+
+    for (int k = 0; k < nb; k++) {
+        printf("Requete %d (op %d, %d, %d): ", k, requetes[k].op, requetes[k].u, requetes[k].v);
+        if (entetes[2 * k] == SOMMET_INVALIDE) {
+            printf("sommet invalide\n");
+        } else if (entetes[2 * k] == OP_INCONNUE) {
+            printf("operation inconnue\n");
+        } else {
+            for (int j = 0; j < entetes[2 * k + 1]; j++) {
+                printf("%d ", reponses[k][j]);
+            }
+            printf("\n");
+        }
+        free(reponses[k]);
+    }
+    double us = (t1.tv_sec - t0.tv_sec) * 1e6 + (t1.tv_nsec - t0.tv_nsec) / 1e3;
+    if (nb > 0) {
+        printf("%d requetes en %.1f us (%.2f us par requete)\n", nb, us, us / nb);
+    }
+    free(reponses);
+    free(entetes);
+    free(requetes);
+    return 0;
+}
+
+int main(int argc, char **argv){
+    if (argc >= 2 && strcmp(argv[1], "serveur") == 0) {
+        const char *fichier = argc >= 3 ? argv[2] : "mon_graphe.txt";
+        const char *chemin = argc >= 4 ? argv[3] : "/tmp/graphe.sock";
+        int nb_threads = argc >= 5 ? atoi(argv[4]) : 4;
+        return serveur(fichier, chemin, nb_threads);
+    }
+    if (argc >= 2 && strcmp(argv[1], "client") == 0) {
+        return client(argc >= 3 ? argv[2] : "/tmp/graphe.sock");
+    }
+    printf("Usage: %s serveur [fichier] [socket] [threads]\n", argv[0]);
+    printf("       %s client [socket] < commandes\n", argv[0]);
+    return 1;
+}
@@ -0,0 +1,484 @@
+// iteration generique y = A x (matrice creuse en CSR, coefficients optionnels) sur plusieurs
+// threads avec le meme nombre de liens chacun et une mise a jour par ligne fournie par
+// l'appelant, arret par tolerance ou nombre d'iterations; PageRank est construit dessus:
+// methode "pull" sur la transposee, contributions divisees par le degre calculees une fois
+// par iteration.
+
+#define _POSIX_C_SOURCE 200112L // pthread_barrier_t avec -std=c11
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// matrice creuse en lignes compressees (CSR): les colonnes de la ligne v sont
+// colonnes[debut[v]] .. colonnes[debut[v+1] - 1], tout est contigu en memoire
+// y[v] = somme des valeurs[k] * x[colonnes[k]] de la ligne v (valeurs NULL: toutes a 1)
+// methode "pull": chaque thread ecrit seulement ses propres y[v], pas besoin de verrou
+// ni d'operation atomique
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    int n;
+    long nnz; // nombre d'elements non nuls
+    long *debut; // n + 1 elements
+    int *colonnes; // nnz elements
+    double *valeurs; // nnz elements, NULL si tous les coefficients valent 1
+} MatriceCSR;
+
+// transposee de G directement en CSR: la ligne v contient les predecesseurs de v dans G
+// (comptage des degres entrants puis remplissage, pas de listes intermediaires)
+// pour un graphe non oriente chaque arete est dans les deux listes: on obtient G lui meme
+void csr_transposee(MatriceCSR *A, Graphe *G) {
+    A->n = G->n;
+    A->debut = (long *)calloc(G->n + 1, sizeof(long));
+    for (int u = 0; u < G->n; u++) { // compter les predecesseurs de chaque sommet
+        for (Noeud *current = G->listes[u]; current != NULL; current = current->suivant) {
+            A->debut[current->s.id + 1]++;
+        }
+    }
+    for (int v = 0; v < G->n; v++) {
+        A->debut[v + 1] += A->debut[v];
+    }
+    A->nnz = A->debut[G->n];
+    A->colonnes = (int *)malloc((A->nnz + 1) * sizeof(int));
+    A->valeurs = NULL;
+    long *pos = (long *)malloc((G->n + 1) * sizeof(long));
+    memcpy(pos, A->debut, G->n * sizeof(long));
+    for (int u = 0; u < G->n; u++) {
+        for (Noeud *current = G->listes[u]; current != NULL; current = current->suivant) {
+            A->colonnes[pos[current->s.id]++] = u;
+        }
+    }
+    free(pos);
+}
+
+void liberer_csr(MatriceCSR *A) {
+    free(A->debut);
+    free(A->colonnes);
+    free(A->valeurs);
+}
+
+// y[v] = ligne v de A x, pour v dans [debut, fin)
+static inline void spmv_plage(const MatriceCSR *A, const double *restrict x, double *restrict y, int debut, int fin) {
+    const double *restrict valeurs = A->valeurs;
+    for (int v = debut; v < fin; v++) {
+        double somme = 0;
+        long k0 = A->debut[v], k1 = A->debut[v + 1];
+        const int *restrict col = A->colonnes;
+        if (valeurs == NULL) {
+            for (long k = k0; k < k1; k++) {
+                somme += x[col[k]];
+            }
+        } else {
+            for (long k = k0; k < k1; k++) {
+                somme += valeurs[k] * x[col[k]];
+            }
+        }
+        y[v] = somme;
+    }
+}
+
+// decoupe les lignes en nb_threads plages avec a peu pres le meme nombre de liens
+// (+ 1 par ligne pour tenir compte du travail par sommet): bornes a nb_threads + 1 elements
+void decouper_plages(const MatriceCSR *A, int nb_threads, int *bornes) {
+    long total = A->nnz + A->n;
+    int v = 0;
+    bornes[0] = 0;
+    for (int t = 1; t < nb_threads; t++) {
+        long cible = total * t / nb_threads;
+        while (v < A->n && A->debut[v] + v < cible) {
+            v++;
+        }
+        bornes[t] = v;
+    }
+    bornes[nb_threads] = A->n;
+}
+
+// ---------------------------------------------------------------------------
+// iteration generique y = A x repetee: chaque thread garde la meme plage de lignes
+// a chaque iteration, 3 barrieres par iteration:
+//   1. preparer: le thread remplit x sur ses lignes (ex: r(u) / degre(u))
+//   2. produit y = A x sur ses lignes puis mettre_a_jour de ses lignes a partir de y,
+//      qui retourne l'ecart de ces lignes avec l'iteration precedente
+//   3. le thread 0 additionne les ecarts (toujours dans le meme ordre: resultat
+//      deterministe), appelle fin_iteration et decide de continuer
+// arret quand la somme des ecarts < tolerance ou apres max_iterations
+// ---------------------------------------------------------------------------
+
+#define MAX_THREADS 64
+
+typedef struct {
+    const MatriceCSR *A;
+    double *x; // vecteur multiplie par A (n elements)
+    double *y; // resultat de A x (n elements)
+    void *donnees; // donnees de l'appelant, passees aux fonctions ci dessous
+    void (*preparer)(void *donnees, int t, int debut, int fin); // NULL: x ne change pas
+    double (*mettre_a_jour)(void *donnees, int t, int debut, int fin, const double *y);
+    void (*fin_iteration)(void *donnees); // thread 0 seul, NULL: rien a faire
+    double tolerance;
+    int max_iterations;
+} IterationSpmv;
+
+typedef struct {
+    IterationSpmv *it;
+    int nb_threads;
+    int *bornes;
+    double ecarts[MAX_THREADS]; // retour de mettre_a_jour, par thread
+    int iterations; // nombre d'iterations faites
+    bool fini;
+    pthread_barrier_t barriere;
+} Moteur;
+
+typedef struct {
+    Moteur *moteur;
+    int t;
+} ArgMoteur;
+
+void *thread_iteration(void *arg) {
+    ArgMoteur *a = (ArgMoteur *)arg;
+    Moteur *moteur = a->moteur;
+    IterationSpmv *it = moteur->it;
+    int t = a->t;
+    int debut = moteur->bornes[t], fin = moteur->bornes[t + 1];
+    while (true) {
+        if (it->preparer != NULL) {
+            it->preparer(it->donnees, t, debut, fin);
+        }
+        pthread_barrier_wait(&moteur->barriere);
+
+        spmv_plage(it->A, it->x, it->y, debut, fin);
+        moteur->ecarts[t] = it->mettre_a_jour(it->donnees, t, debut, fin, it->y);
+        pthread_barrier_wait(&moteur->barriere);
+
+        if (t == 0) {
+            double total = 0;
+            for (int k = 0; k < moteur->nb_threads; k++) {
+                total += moteur->ecarts[k];
+            }
+            if (it->fin_iteration != NULL) {
+                it->fin_iteration(it->donnees);
+            }
+            moteur->iterations++;
+            moteur->fini = total < it->tolerance || moteur->iterations >= it->max_iterations;
+        }
+        pthread_barrier_wait(&moteur->barriere);
+        if (moteur->fini) {
+            return NULL;
+        }
+    }
+}
+
+// lance l'iteration sur nb_threads threads, retourne le nombre d'iterations
+int iterer_spmv(IterationSpmv *it, int nb_threads) {
+    if (it->A->n == 0) {
+        return 0;
+    }
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+    if (it->max_iterations < 1) it->max_iterations = 1;
+
+    Moteur moteur;
+    moteur.it = it;
+    moteur.nb_threads = nb_threads;
+    moteur.bornes = (int *)malloc((nb_threads + 1) * sizeof(int));
+    decouper_plages(it->A, nb_threads, moteur.bornes);
+    moteur.iterations = 0;
+    moteur.fini = false;
+    pthread_barrier_init(&moteur.barriere, NULL, nb_threads);
+
+    pthread_t threads[MAX_THREADS];
+    ArgMoteur args[MAX_THREADS];
+    for (int t = 0; t < nb_threads; t++) {
+        args[t].moteur = &moteur;
+        args[t].t = t;
+        pthread_create(&threads[t], NULL, thread_iteration, &args[t]);
+    }
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_barrier_destroy(&moteur.barriere);
+    free(moteur.bornes);
+    return moteur.iterations;
+}
+
+// ---------------------------------------------------------------------------
+// PageRank: r(v) = (1 - d) / n + d * (somme des r(u) / degre_sortant(u) pour u -> v
+//                                     + somme des r des sommets sans successeur / n)
+// construit sur iterer_spmv avec A = transposee de G et x = contributions r(u) / degre(u)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    int n;
+    int nb_threads;
+    const double *inv_degre; // 1 / degre sortant, 0 si pas de successeur
+    double amortissement; // d
+    double *rang, *nouveau, *contribution;
+    double pendants[MAX_THREADS]; // somme des rangs des sommets sans successeur, par thread
+} PageRank;
+
+// contributions r(u) / degre(u), precalculees une fois par iteration
+void pagerank_preparer(void *donnees, int t, int debut, int fin) {
+    PageRank *pr = (PageRank *)donnees;
+    const double *restrict rang = pr->rang;
+    double *restrict contribution = pr->contribution;
+    const double *restrict inv_degre = pr->inv_degre;
+    double pendant = 0;
+    for (int u = debut; u < fin; u++) {
+        contribution[u] = rang[u] * inv_degre[u];
+        pendant += (inv_degre[u] == 0) ? rang[u] : 0;
+    }
+    pr->pendants[t] = pendant;
+}
+
+// somme = contributions tirees des predecesseurs
+double pagerank_mettre_a_jour(void *donnees, int t, int debut, int fin, const double *somme) {
+    (void)t;
+    PageRank *pr = (PageRank *)donnees;
+    double d = pr->amortissement;
+    double total_pendant = 0;
+    for (int k = 0; k < pr->nb_threads; k++) { // meme ordre pour tous: resultat deterministe
+        total_pendant += pr->pendants[k];
+    }
+    double base = (1 - d) / pr->n + d * total_pendant / pr->n;
+    const double *restrict rang = pr->rang;
+    double *restrict nouveau = pr->nouveau;
+    double ecart = 0;
+    for (int v = debut; v < fin; v++) {
+        nouveau[v] = base + d * somme[v];
+        ecart += fabs(nouveau[v] - rang[v]);
+    }
+    return ecart;
+}
+
+void pagerank_fin_iteration(void *donnees) {
+    PageRank *pr = (PageRank *)donnees;
+    double *tmp = pr->rang;
+    pr->rang = pr->nouveau;
+    pr->nouveau = tmp;
+}
+
+// rang: n elements, rempli avec le PageRank de chaque sommet (somme = 1)
+// retourne le nombre d'iterations
+int pagerank(Graphe *G, double *rang, double amortissement, double tolerance, int max_iterations, int nb_threads) {
+    int n = G->n;
+    if (n == 0) {
+        return 0;
+    }
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+
+    MatriceCSR A;
+    csr_transposee(&A, G);
+
+    double *inv_degre = (double *)malloc(n * sizeof(double));
+    for (int u = 0; u < n; u++) {
+        int deg = longueur_liste(G->listes[u]);
+        inv_degre[u] = deg > 0 ? 1.0 / deg : 0;
+    }
+
+    PageRank pr;
+    pr.n = n;
+    pr.nb_threads = nb_threads;
+    pr.inv_degre = inv_degre;
+    pr.amortissement = amortissement;
+    pr.rang = (double *)malloc(n * sizeof(double));
+    pr.nouveau = (double *)malloc(n * sizeof(double));
+    pr.contribution = (double *)malloc(n * sizeof(double));
+    double *somme = (double *)malloc(n * sizeof(double));
+    for (int v = 0; v < n; v++) {
+        pr.rang[v] = 1.0 / n; // depart uniforme
+    }
+
+    IterationSpmv it;
+    it.A = &A;
+    it.x = pr.contribution;
+    it.y = somme;
+    it.donnees = &pr;
+    it.preparer = pagerank_preparer;
+    it.mettre_a_jour = pagerank_mettre_a_jour;
+    it.fin_iteration = pagerank_fin_iteration;
+    it.tolerance = tolerance;
+    it.max_iterations = max_iterations;
+    int iterations = iterer_spmv(&it, nb_threads);
+
+    memcpy(rang, pr.rang, n * sizeof(double));
+    free(pr.rang);
+    free(pr.nouveau);
+    free(pr.contribution);
+    free(somme);
+    free(inv_degre);
+    liberer_csr(&A);
+    return iterations;
+}
+
+int main(){
+    Graphe g;
+    charge(&g, "mon_graphe.txt");
+    afficher_simple(&g);
+
+    printf("\nFacteur d'amortissement (0.85): ");
+    double d;
+    scanf("%lf", &d);
+    printf("Tolerance (1e-10): ");
+    double tolerance;
+    scanf("%lf", &tolerance);
+    printf("Nombre maximal d'iterations: ");
+    int max_iterations;
+    scanf("%d", &max_iterations);
+    printf("Nombre de threads: ");
+    int nb_threads;
+    scanf("%d", &nb_threads);
+
+    double *rang = (double *)malloc(g.n * sizeof(double));
+    int iterations = pagerank(&g, rang, d, tolerance, max_iterations, nb_threads);
+    printf("\n%d iterations\n", iterations);
+    printf("Sommet\tPageRank\n");
+    for (int i = 0; i < g.n; i++) {
+        printf("%d\t%.6f\n", i, rang[i]);
+    }
+
+    free(rang);
+    liberer_graphe(&g);
+    return 0;
+}
@@ -0,0 +1,568 @@
+// vues legeres sur un graphe (sous graphe, transposee, non orientee, graphe de liaison): meme
+// interface de parcours des voisins qu'un graphe, mais les voisins sont lus dans le graphe
+// source au lieu de construire et copier un nouveau Graphe, pour DFS, BFS et composantes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+void afficher_parcours(int id, int *d, int *f, int *p, int n) {
+    printf("Sommet\tDecouverte\tFin\tPredecesseur\n");
+    for (int i = 0; i < n; i++) {
+        if(i != id && p[i] == -1) continue; // si sommet n'est pas accessible
+        printf("%d\t%d\t\t%d\t%d\n", i, d[i], f[i], p[i]);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// vues: meme interface de parcours des voisins qu'un graphe, mais sans construire de
+// nouveau graphe; chaque vue lit directement les listes du graphe source
+//   vue_debut(V, u, &it) puis while (vue_suivant(V, &it, &v)) { ... }
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    Noeud *courant; // vues qui lisent une liste du graphe source
+    int k; // vues qui lisent un tableau (indice courant)
+    int fin;
+    int u;
+} Iterateur;
+
+typedef struct vue {
+    int n; // nombre de sommets (ids 0..n-1 comme dans le graphe source)
+    bool oriente;
+    void (*debut)(struct vue *V, int u, Iterateur *it);
+    bool (*suivant)(struct vue *V, Iterateur *it, int *v);
+    bool (*contient)(struct vue *V, int u); // false: sommet filtre, a ignorer
+    Graphe *G; // graphe source
+    bool *dans; // vue sous graphe: dans[v] = v est dans S
+    int *debut_idx, *idx; // vue transposee: predecesseurs; vue liaison: fils
+    int *p; // vue liaison: predecesseurs du parcours
+} Vue;
+
+static inline void vue_debut(Vue *V, int u, Iterateur *it) {
+    V->debut(V, u, it);
+}
+
+static inline bool vue_suivant(Vue *V, Iterateur *it, int *v) {
+    return V->suivant(V, it, v);
+}
+
+bool toujours(Vue *V, int u) {
+    (void)V;
+    (void)u;
+    return true;
+}
+
+// --- le graphe lui meme ---
+
+void graphe_debut(Vue *V, int u, Iterateur *it) {
+    it->courant = V->G->listes[u];
+    it->u = u;
+}
+
+bool graphe_suivant(Vue *V, Iterateur *it, int *v) {
+    (void)V;
+    if (it->courant == NULL) {
+        return false;
+    }
+    *v = it->courant->s.id;
+    it->courant = it->courant->suivant;
+    return true;
+}
+
+void vue_graphe(Vue *V, Graphe *G) {
+    V->n = G->n;
+    V->oriente = G->oriente;
+    V->debut = graphe_debut;
+    V->suivant = graphe_suivant;
+    V->contient = toujours;
+    V->G = G;
+    V->dans = NULL;
+    V->debut_idx = V->idx = V->p = NULL;
+}
+
+// --- sous graphe induit par les nb sommets de S (les ids restent ceux de G) ---
+// remplace sous_graphe: seulement un tableau de n booleens, les listes de G sont filtrees
+// pendant la lecture
+
+bool sous_graphe_contient(Vue *V, int u) {
+    return V->dans[u];
+}
+
+bool sous_graphe_suivant(Vue *V, Iterateur *it, int *v) {
+    while (it->courant != NULL) {
+        int w = it->courant->s.id;
+        it->courant = it->courant->suivant;
+        if (V->dans[w]) {
+            *v = w;
+            return true;
+        }
+    }
+    return false;
+}
+
+void sous_graphe_debut(Vue *V, int u, Iterateur *it) {
+    it->courant = V->dans[u] ? V->G->listes[u] : NULL; // sommet hors de S: pas de voisin
+    it->u = u;
+}
+
+void vue_sous_graphe(Vue *V, Graphe *G, int nb, Sommet *S) {
+    vue_graphe(V, G);
+    V->debut = sous_graphe_debut;
+    V->suivant = sous_graphe_suivant;
+    V->contient = sous_graphe_contient;
+    V->dans = (bool *)calloc(G->n, sizeof(bool));
+    for (int i = 0; i < nb; i++) {
+        V->dans[S[i].id] = true;
+    }
+}
+
+// --- tableau d'indices: idx[debut_idx[u]] .. idx[debut_idx[u+1] - 1] ---
+
+void tableau_debut(Vue *V, int u, Iterateur *it) {
+    it->k = V->debut_idx[u];
+    it->fin = V->debut_idx[u + 1];
+    it->u = u;
+}
+
+bool tableau_suivant(Vue *V, Iterateur *it, int *v) {
+    if (it->k == it->fin) {
+        return false;
+    }
+    *v = V->idx[it->k++];
+    return true;
+}
+
+// --- transposee: arcs inverses ---
+// les listes ne donnent que les successeurs, il faut donc un index des predecesseurs:
+// un seul tableau d'entiers (4 octets par arc) au lieu d'un Noeud alloue par arc
+// pour un graphe non oriente la transposee est le graphe lui meme: rien a construire
+
+// index des predecesseurs: ceux de v sont idx[debut_idx[v]] .. idx[debut_idx[v+1] - 1]
+void indexer_predecesseurs(Vue *V, Graphe *G) {
+    V->debut_idx = (int *)calloc(G->n + 1, sizeof(int));
+    int m = 0;
+    for (int u = 0; u < G->n; u++) { // compter les predecesseurs de chaque sommet
+        for (Noeud *current = G->listes[u]; current != NULL; current = current->suivant) {
+            V->debut_idx[current->s.id + 1]++;
+            m++;
+        }
+    }
+    for (int v = 0; v < G->n; v++) {
+        V->debut_idx[v + 1] += V->debut_idx[v];
+    }
+    V->idx = (int *)malloc((m + 1) * sizeof(int));
+    int *pos = (int *)malloc(G->n * sizeof(int));
+    memcpy(pos, V->debut_idx, G->n * sizeof(int));
+    for (int u = 0; u < G->n; u++) {
+        for (Noeud *current = G->listes[u]; current != NULL; current = current->suivant) {
+            V->idx[pos[current->s.id]++] = u;
+        }
+    }
+    free(pos);
+}
+
+void vue_transposee(Vue *V, Graphe *G) {
+    vue_graphe(V, G);
+    if (!G->oriente) {
+        return;
+    }
+    indexer_predecesseurs(V, G);
+    V->debut = tableau_debut;
+    V->suivant = tableau_suivant;
+}
+
+// --- graphe non oriente sous jacent: successeurs (liste) puis predecesseurs (index) ---
+// meme index que la transposee; pas de dedoublonnage: si u -> v et v -> u, v est donne
+// deux fois parmi les voisins de u (une boucle u -> u aussi), sans effet sur les parcours
+// et les composantes
+
+void non_oriente_debut(Vue *V, int u, Iterateur *it) {
+    it->courant = V->G->listes[u];
+    it->k = V->debut_idx[u];
+    it->fin = V->debut_idx[u + 1];
+    it->u = u;
+}
+
+bool non_oriente_suivant(Vue *V, Iterateur *it, int *v) {
+    if (it->courant != NULL) {
+        *v = it->courant->s.id;
+        it->courant = it->courant->suivant;
+        return true;
+    }
+    return tableau_suivant(V, it, v);
+}
+
+void vue_non_orientee(Vue *V, Graphe *G) {
+    vue_graphe(V, G);
+    if (!G->oriente) { // deja non oriente: les listes donnent tous les voisins
+        return;
+    }
+    V->oriente = false;
+    indexer_predecesseurs(V, G);
+    V->debut = non_oriente_debut;
+    V->suivant = non_oriente_suivant;
+}
+
+// --- graphe de liaison (arbre des predecesseurs p d'un parcours) ---
+// remplace liaison: les fils de u sont ranges a la suite (2 tableaux d'entiers),
+// pour un graphe non oriente le predecesseur p[u] est aussi un voisin de u
+
+bool liaison_suivant(Vue *V, Iterateur *it, int *v) {
+    if (it->k < it->fin) {
+        *v = V->idx[it->k++];
+        return true;
+    }
+    if (!V->oriente && it->k == it->fin && V->p[it->u] != -1) {
+        it->k++; // le predecesseur n'est donne qu'une fois
+        *v = V->p[it->u];
+        return true;
+    }
+    return false;
+}
+
+void vue_liaison(Vue *V, Graphe *G, int *p) {
+    vue_graphe(V, G);
+    V->p = p;
+    V->debut_idx = (int *)calloc(G->n + 1, sizeof(int));
+    int nb = 0;
+    for (int v = 0; v < G->n; v++) {
+        if (p[v] != -1) {
+            V->debut_idx[p[v] + 1]++;
+            nb++;
+        }
+    }
+    for (int u = 0; u < G->n; u++) {
+        V->debut_idx[u + 1] += V->debut_idx[u];
+    }
+    V->idx = (int *)malloc((nb + 1) * sizeof(int));
+    int *pos = (int *)malloc(G->n * sizeof(int));
+    memcpy(pos, V->debut_idx, G->n * sizeof(int));
+    for (int v = 0; v < G->n; v++) {
+        if (p[v] != -1) {
+            V->idx[pos[p[v]]++] = v;
+        }
+    }
+    free(pos);
+    V->debut = tableau_debut;
+    V->suivant = liaison_suivant;
+}
+
+void liberer_vue(Vue *V) {
+    free(V->dans);
+    free(V->debut_idx);
+    free(V->idx);
+}
+
+// ---------------------------------------------------------------------------
+// algorithmes ecrits une seule fois pour toutes les vues
+// ---------------------------------------------------------------------------
+
+void DFS_visit_vue(Vue *V, int u, int *d, int *f, int *p, int *time, int *color) {
+    color[u] = 1; // gris
+    d[u] = ++(*time);
+    Iterateur it;
+    int v;
+    vue_debut(V, u, &it);
+    while (vue_suivant(V, &it, &v)) {
+        if (color[v] == 0) { // blanc
+            p[v] = u;
+            DFS_visit_vue(V, v, d, f, p, time, color);
+        }
+    }
+    color[u] = 2; // noir
+    f[u] = ++(*time);
+}
+
+void parcours_vue(Vue *V, int id, int *d, int *f, int *p) {
+    int *color = (int *)malloc(V->n * sizeof(int)); // 0: blanc, 1: gris, 2: noir
+    for (int i = 0; i < V->n; i++) {
+        color[i] = 0;
+        p[i] = -1;
+    }
+    int time = 0;
+    DFS_visit_vue(V, id, d, f, p, &time, color);
+    free(color);
+}
+
+// parcours en largeur: ordre[] recoit les sommets dans l'ordre de decouverte,
+// retourne leur nombre
+int parcours_largeur_vue(Vue *V, int id, int *ordre, int *p) {
+    bool *vu = (bool *)calloc(V->n, sizeof(bool));
+    for (int i = 0; i < V->n; i++) {
+        p[i] = -1;
+    }
+    int tete = 0, fin = 0;
+    ordre[fin++] = id;
+    vu[id] = true;
+    Iterateur it;
+    int v;
+    while (tete < fin) {
+        int u = ordre[tete++];
+        vue_debut(V, u, &it);
+        while (vue_suivant(V, &it, &v)) {
+            if (!vu[v]) {
+                vu[v] = true;
+                p[v] = u;
+                ordre[fin++] = v;
+            }
+        }
+    }
+    free(vu);
+    return fin;
+}
+
+// c[i] = composante de i, -1 pour les sommets filtres par la vue
+void composantes_vue(Vue *V, int *d, int *f, int *p, int *c) {
+    int *color = (int *)malloc(V->n * sizeof(int)); // 0: blanc, 1: gris, 2: noir
+    for (int i = 0; i < V->n; i++) {
+        color[i] = 0;
+        p[i] = -1;
+        c[i] = -1;
+    }
+    int time = 0;
+    int component_id = 0;
+    for (int i = 0; i < V->n; i++) {
+        if (color[i] == 0 && V->contient(V, i)) {
+            int debut = time; // les sommets decouverts maintenant ont d > debut
+            DFS_visit_vue(V, i, d, f, p, &time, color);
+            for (int j = i; j < V->n; j++) {
+                if (c[j] == -1 && color[j] == 2 && d[j] > debut) {
+                    c[j] = component_id;
+                }
+            }
+            component_id++;
+        }
+    }
+    free(color);
+}
+
+void afficher_vue(Vue *V) {
+    Iterateur it;
+    int v;
+    for (int i = 0; i < V->n; i++) {
+        if (!V->contient(V, i)) {
+            continue;
+        }
+        vue_debut(V, i, &it);
+        if (!vue_suivant(V, &it, &v)) {
+            continue;
+        }
+        printf("Sommet %d: %d -> ", i, v);
+        while (vue_suivant(V, &it, &v)) {
+            printf("%d -> ", v);
+        }
+        printf("Null\n");
+    }
+}
+
+int main(){
+    Graphe g;
+    charge(&g, "mon_graphe.txt");
+    printf("Graphe original:\n");
+    afficher_simple(&g);
+
+    int n = g.n;
+    int *d = (int *)malloc(n * sizeof(int));
+    int *f = (int *)malloc(n * sizeof(int));
+    int *p = (int *)malloc(n * sizeof(int));
+    int *c = (int *)malloc(n * sizeof(int));
+    int *ordre = (int *)malloc(n * sizeof(int));
+
+    printf("\nEntrer sommet source: ");
+    int id;
+    scanf("%d", &id);
+    if (id < 0 || id >= n) {
+        printf("Sommet invalide\n");
+        return 1;
+    }
+
+    Vue vg;
+    vue_graphe(&vg, &g);
+    parcours_vue(&vg, id, d, f, p);
+    afficher_parcours(id, d, f, p, n);
+
+    Vue vs;
+    Sommet S[3] = {{0}, {2}, {3}};
+    vue_sous_graphe(&vs, &g, 3, S);
+    printf("\nVue sous graphe (0, 2, 3):\n");
+    afficher_vue(&vs);
+    composantes_vue(&vs, d, f, p, c);
+    for (int i = 0; i < 3; i++) {
+        printf("Sommet %d: Composante %d\n", S[i].id, c[S[i].id]);
+    }
+
+    Vue vt;
+    vue_transposee(&vt, &g);
+    printf("\nVue transposee:\n");
+    afficher_vue(&vt);
+    int nb = parcours_largeur_vue(&vt, id, ordre, p);
+    printf("Sommets qui atteignent %d (BFS sur la transposee):", id);
+    for (int k = 0; k < nb; k++) {
+        printf(" %d", ordre[k]);
+    }
+    printf("\n");
+
+    Vue vn;
+    vue_non_orientee(&vn, &g);
+    printf("\nVue non orientee:\n");
+    afficher_vue(&vn);
+    composantes_vue(&vn, d, f, p, c);
+    printf("Composantes faiblement connexes:\n");
+    for (int i = 0; i < n; i++) {
+        printf("Sommet %d: Composante %d\n", i, c[i]);
+    }
+
+    parcours_vue(&vg, id, d, f, p);
+    Vue vl;
+    vue_liaison(&vl, &g, p);
+    printf("\nVue graphe de liaison:\n");
+    afficher_vue(&vl);
+
+    liberer_vue(&vg);
+    liberer_vue(&vs);
+    liberer_vue(&vt);
+    liberer_vue(&vn);
+    liberer_vue(&vl);
+    free(d); free(f); free(p); free(c); free(ordre);
+    liberer_graphe(&g);
+    return 0;
+}
@@ -0,0 +1,481 @@
+// generateurs de graphes sans echelle (degres tres inegaux): R-MAT / Kronecker et
+// Barabasi-Albert (attachement preferentiel), en parallele, reproductibles avec une graine,
+// les liens sont ecrits directement dans le fichier (texte ou binaire) sans passer par un Graphe.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <pthread.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// format binaire: int32 oriente, int32 n, int64 m, puis m paires int32 (id1, id2)
+// (ordre des octets de la machine)
+// ---------------------------------------------------------------------------
+
+void charge_binaire(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "rb");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int32_t entete[2];
+    int64_t m;
+    if (fread(entete, sizeof(int32_t), 2, fichier) != 2 || fread(&m, sizeof(int64_t), 1, fichier) != 1) {
+        printf("Erreur: entete invalide\n");
+        fclose(fichier);
+        return;
+    }
+    init_graphe(g, entete[1], entete[0]);
+    int32_t lien[2];
+    for (int64_t i = 0; i < m && fread(lien, sizeof(int32_t), 2, fichier) == 2; i++) {
+        ajout_lien(g, lien[0], lien[1]);
+    }
+    fclose(fichier);
+}
+
+// ---------------------------------------------------------------------------
+// nombres aleatoires reproductibles: splitmix64
+// chaque bloc de liens a son propre generateur, initialise a partir de (graine, bloc):
+// le fichier obtenu ne depend que de la graine, pas du nombre de threads
+// ---------------------------------------------------------------------------
+
+static inline uint64_t melanger64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static inline uint64_t aleatoire(uint64_t *etat) {
+    *etat += 0x9e3779b97f4a7c15ULL;
+    return melanger64(*etat);
+}
+
+// reel dans [0, 1)
+static inline double aleatoire_reel(uint64_t *etat) {
+    return (aleatoire(etat) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// ---------------------------------------------------------------------------
+// generation en parallele, ecriture en flux
+// les liens sont produits par blocs de LIENS_PAR_BLOC; un thread prend le prochain
+// bloc, le genere et le formate dans son tampon, puis attend son tour pour l'ecrire
+// -> la memoire ne depend que du nombre de threads, jamais du nombre de liens
+// ---------------------------------------------------------------------------
+
+#define MAX_THREADS 64
+#define LIENS_PAR_BLOC 65536
+
+enum { RMAT, BARABASI_ALBERT };
+
+typedef struct {
+    int modele;
+    bool binaire;
+    uint64_t graine;
+    FILE *fichier;
+    int64_t m; // nombre total de liens
+    int64_t nb_blocs;
+    // R-MAT
+    int echelle; // n = 2^echelle
+    double a, b, c; // d = 1 - a - b - c
+    bool permuter; // renumeroter les sommets (sinon les petits ids ont les grands degres)
+    // Barabasi-Albert
+    int liens_par_sommet;
+    // partage entre les threads
+    pthread_mutex_t verrou;
+    pthread_cond_t tour;
+    int64_t prochain_bloc; // prochain bloc a generer
+    int64_t prochain_ecrit; // prochain bloc a ecrire
+} Generateur;
+
+// bijection sur [0, 2^echelle): multiplications impaires et decalages modulo 2^echelle
+static inline uint32_t permuter_id(uint32_t x, int echelle, uint64_t graine) {
+    uint32_t masque = echelle >= 32 ? 0xffffffffu : ((1u << echelle) - 1);
+    uint32_t k = (uint32_t)melanger64(graine) | 1; // impair -> inversible
+    for (int tour = 0; tour < 2; tour++) {
+        x = (x * k) & masque;
+        x ^= x >> (echelle / 2 + 1);
+    }
+    return x & masque;
+}
+
+// R-MAT: a chaque niveau on choisit un quart de la matrice d'adjacence avec les
+// probabilites a (haut gauche), b, c, d -> degres tres inegaux comme les vrais graphes
+// (un graphe de Kronecker avec la matrice initiale [[a, b], [c, d]])
+static inline void lien_rmat(Generateur *gen, uint64_t *etat, int32_t *u, int32_t *v) {
+    uint32_t x = 0, y = 0;
+    double ab = gen->a + gen->b, abc = gen->a + gen->b + gen->c;
+    for (int niveau = 0; niveau < gen->echelle; niveau++) {
+        double r = aleatoire_reel(etat);
+        x <<= 1;
+        y <<= 1;
+        if (r < gen->a) {
+            // haut gauche
+        } else if (r < ab) {
+            y |= 1; // haut droite
+        } else if (r < abc) {
+            x |= 1; // bas gauche
+        } else {
+            x |= 1; // bas droite
+            y |= 1;
+        }
+    }
+    if (gen->permuter) {
+        x = permuter_id(x, gen->echelle, gen->graine);
+        y = permuter_id(y, gen->echelle, gen->graine);
+    }
+    *u = (int32_t)x;
+    *v = (int32_t)y;
+}
+
+// Barabasi-Albert (attachement preferentiel), version sans etat partage:
+// le lien i part du sommet i / liens_par_sommet; sa cible est une extremite d'un lien
+// precedent choisie uniformement (2i + 1 positions) -> un sommet est choisi en proportion
+// de son degre. Si on tombe sur la cible d'un lien j < i, on recommence avec j.
+// Le tirage de la position ne depend que de (graine, i): chaque lien se calcule seul,
+// donc les blocs se generent en parallele sans rien garder en memoire
+static inline void lien_barabasi_albert(Generateur *gen, int64_t i, int32_t *u, int32_t *v) {
+    int64_t d = gen->liens_par_sommet;
+    *u = (int32_t)(i / d);
+    int64_t j = i;
+    while (true) {
+        uint64_t r = melanger64(gen->graine ^ melanger64((uint64_t)j)) % (uint64_t)(2 * j + 1);
+        if (r % 2 == 0) { // source du lien r / 2
+            *v = (int32_t)((int64_t)(r / 2) / d);
+            return;
+        }
+        j = (int64_t)(r / 2); // cible du lien r / 2, j diminue a chaque tour
+    }
+}
+
+// ecrit x en decimal dans buf (x >= 0), retourne le nombre de caracteres
+int entier_vers_texte(char *buf, int32_t x) {
+    char tmp[12];
+    int k = 12;
+    uint32_t u = (uint32_t)x;
+    do {
+        tmp[--k] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+    memcpy(buf, tmp + k, 12 - k);
+    return 12 - k;
+}
+
+void *thread_generation(void *arg) {
+    Generateur *gen = (Generateur *)arg;
+    char *tampon = (char *)malloc(LIENS_PAR_BLOC * 24);
+    while (true) {
+        pthread_mutex_lock(&gen->verrou);
+        int64_t bloc = gen->prochain_bloc++;
+        pthread_mutex_unlock(&gen->verrou);
+        if (bloc >= gen->nb_blocs) {
+            break;
+        }
+
+        int64_t debut = bloc * LIENS_PAR_BLOC;
+        int64_t fin = debut + LIENS_PAR_BLOC < gen->m ? debut + LIENS_PAR_BLOC : gen->m;
+        uint64_t etat = melanger64(gen->graine + melanger64((uint64_t)bloc));
+        char *p = tampon;
+        for (int64_t i = debut; i < fin; i++) {
+            int32_t u, v;
+            if (gen->modele == RMAT) {
+                lien_rmat(gen, &etat, &u, &v);
+            } else {
+                lien_barabasi_albert(gen, i, &u, &v);
+            }
+            if (gen->binaire) {
+                memcpy(p, &u, sizeof(int32_t));
+                memcpy(p + sizeof(int32_t), &v, sizeof(int32_t));
+                p += 2 * sizeof(int32_t);
+            } else {
+                p += entier_vers_texte(p, u);
+                *p++ = ' ';
+                p += entier_vers_texte(p, v);
+                *p++ = '\n';
+            }
+        }
+
+        // ecriture dans l'ordre des blocs
+        pthread_mutex_lock(&gen->verrou);
+        while (gen->prochain_ecrit != bloc) {
+            pthread_cond_wait(&gen->tour, &gen->verrou);
+        }
+        pthread_mutex_unlock(&gen->verrou);
+        fwrite(tampon, 1, p - tampon, gen->fichier);
+        pthread_mutex_lock(&gen->verrou);
+        gen->prochain_ecrit++;
+        pthread_cond_broadcast(&gen->tour);
+        pthread_mutex_unlock(&gen->verrou);
+    }
+    free(tampon);
+    return NULL;
+}
+
+// ecrit l'entete puis lance les threads; n et oriente vont dans l'entete
+bool generer(Generateur *gen, const char *nom_fichier, int n, bool oriente, int nb_threads) {
+    gen->fichier = fopen(nom_fichier, gen->binaire ? "wb" : "w");
+    if (gen->fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return false;
+    }
+    if (gen->binaire) {
+        int32_t entete[2] = {oriente, n};
+        int64_t m = gen->m;
+        fwrite(entete, sizeof(int32_t), 2, gen->fichier);
+        fwrite(&m, sizeof(int64_t), 1, gen->fichier);
+    } else {
+        fprintf(gen->fichier, "%d %d %" PRId64 "\n", oriente, n, gen->m);
+    }
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+    gen->nb_blocs = (gen->m + LIENS_PAR_BLOC - 1) / LIENS_PAR_BLOC;
+    gen->prochain_bloc = 0;
+    gen->prochain_ecrit = 0;
+    pthread_mutex_init(&gen->verrou, NULL);
+    pthread_cond_init(&gen->tour, NULL);
+
+    pthread_t threads[MAX_THREADS];
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_create(&threads[t], NULL, thread_generation, gen);
+    }
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_mutex_destroy(&gen->verrou);
+    pthread_cond_destroy(&gen->tour);
+    fclose(gen->fichier);
+    return true;
+}
+
+// graphe R-MAT oriente: 2^echelle sommets, facteur * 2^echelle liens
+// echelle <= 30: n est un int dans les entetes et dans Graphe; m est sur 64 bits
+// (les doublons et boucles sont gardes dans le fichier, charge ignore les doublons)
+bool generationRMAT(const char *nom_fichier, int echelle, int facteur, double a, double b, double c,
+                    uint64_t graine, bool binaire, int nb_threads) {
+    if (echelle < 1 || echelle > 30 || facteur < 1 || (int64_t)facteur > (INT64_MAX >> echelle)
+        || a < 0 || b < 0 || c < 0 || a + b + c > 1) {
+        printf("Parametres R-MAT invalides\n");
+        return false;
+    }
+    Generateur gen;
+    gen.modele = RMAT;
+    gen.binaire = binaire;
+    gen.graine = graine;
+    gen.echelle = echelle;
+    gen.a = a;
+    gen.b = b;
+    gen.c = c;
+    gen.permuter = true;
+    gen.m = (int64_t)facteur << echelle;
+    return generer(&gen, nom_fichier, 1 << echelle, true, nb_threads);
+}
+
+// graphe de Barabasi-Albert non oriente: n sommets, chaque sommet arrive avec
+// liens_par_sommet liens vers des sommets deja presents (choisis selon leur degre)
+bool generationBarabasiAlbert(const char *nom_fichier, int n, int liens_par_sommet,
+                              uint64_t graine, bool binaire, int nb_threads) {
+    if (n < 1 || liens_par_sommet < 1) {
+        printf("Parametres Barabasi-Albert invalides\n");
+        return false;
+    }
+    Generateur gen;
+    gen.modele = BARABASI_ALBERT;
+    gen.binaire = binaire;
+    gen.graine = graine;
+    gen.liens_par_sommet = liens_par_sommet;
+    gen.m = (int64_t)n * liens_par_sommet;
+    return generer(&gen, nom_fichier, n, false, nb_threads);
+}
+
+int main(){
+    printf("R-MAT (0) ou Barabasi-Albert (1): ");
+    int modele;
+    scanf("%d", &modele);
+    printf("Graine: ");
+    uint64_t graine;
+    scanf("%" SCNu64, &graine);
+    printf("Nombre de threads: ");
+    int nb_threads;
+    scanf("%d", &nb_threads);
+    printf("Format texte (0) ou binaire (1): ");
+    int binaire;
+    scanf("%d", &binaire);
+    const char *nom_fichier = binaire ? "graphe_genere.bin" : "graphe_genere.txt";
+
+    bool ok;
+    int n;
+    if (modele == 0) {
+        printf("Echelle (n = 2^echelle): ");
+        int echelle;
+        scanf("%d", &echelle);
+        printf("Liens par sommet: ");
+        int facteur;
+        scanf("%d", &facteur);
+        // probabilites habituelles de Graph500
+        ok = generationRMAT(nom_fichier, echelle, facteur, 0.57, 0.19, 0.19, graine, binaire, nb_threads);
+        n = ok ? 1 << echelle : 0;
+    } else {
+        printf("Nombre de sommets: ");
+        scanf("%d", &n);
+        printf("Liens par sommet: ");
+        int d;
+        scanf("%d", &d);
+        ok = generationBarabasiAlbert(nom_fichier, n, d, graine, binaire, nb_threads);
+    }
+    if (!ok) {
+        return 1;
+    }
+    printf("Graphe ecrit dans %s\n", nom_fichier);
+
+    // verification sur les petits graphes seulement: relire le fichier et l'afficher
+    if (n <= 32) {
+        Graphe g;
+        if (binaire) {
+            charge_binaire(&g, nom_fichier);
+        } else {
+            charge(&g, nom_fichier);
+        }
+        afficher_simple(&g);
+        liberer_graphe(&g);
+    }
+    return 0;
+}
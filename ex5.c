@@ -0,0 +1,474 @@
+// renumerotation des sommets pour ameliorer la localite memoire :
+// calculer une permutation (degre decroissant, Cuthill-McKee inverse ou ordre BFS),
+// construire le graphe renumerote et revenir aux identifiants d'origine pour les resultats
+// de parcours et composantes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+// sommet et son degre, pour trier les sommets par degre
+typedef struct {
+    int id;
+    int degre;
+} SommetDegre;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+// DFS: Depth First Search
+// blanc: sommet non découvert
+// gris: sommet découvert mais pas encore traité
+// noir: sommet traité
+void DFS_visit(Graphe *G, int u, int *d, int *f, int *p, int *time, int *color) {
+    color[u] = 1; // set color de 0 = gris
+    d[u] = ++(*time); // increment temp decouverte
+    Noeud *current = G->listes[u];
+    while (current != NULL) {
+        int v = current->s.id;
+        if (color[v] == 0) { // blanc
+            p[v] = u; // predecesseur de v est u
+            DFS_visit(G, v, d, f, p, time, color); // recursive avec des sommets adjacents de v
+        }
+        current = current->suivant;
+    }
+    color[u] = 2; // noir (fin de traitement)
+    f[u] = ++(*time); // increment temp fin
+}
+
+void parcours(Graphe *G, int id, int *d, int *f, int *p) {
+    int *color = (int *)malloc(G->n * sizeof(int)); // 0: blanc, 1: gris, 2: noir
+    for (int i = 0; i < G->n; i++) {
+        color[i] = 0; // initialiser tous les sommets à blanc
+        p[i] = -1; // initialiser tous les predecesseurs à -1
+    }
+    int time = 0;
+    DFS_visit(G, id, d, f, p, &time, color);
+    free(color);
+}
+
+void afficher_parcours(int id, int *d, int *f, int *p, int n) {
+    printf("Sommet\tDecouverte\tFin\tPredecesseur\n");
+    for (int i = 0; i < n; i++) {
+        if(i != id && p[i] == -1) continue; // si sommet n'est pas accessible
+        printf("%d\t%d\t\t%d\t%d\n", i, d[i], f[i], p[i]);
+    }
+}
+
+// permettant de remplir le tableau c contenant la composante connexe de chaque sommet du graphe
+void composantes(Graphe *G, int id, int *d, int *f, int *p, int *c) {
+    int *color = (int *)malloc(G->n * sizeof(int)); // 0: blanc, 1: gris, 2: noir
+    for (int i = 0; i < G->n; i++) {
+        color[i] = 0;
+        p[i] = -1;
+        c[i] = -1;
+    }
+    int time = 0;
+    int component_id = 0;
+    for (int i = 0; i < G->n; i++) {
+        if (color[i] == 0) {
+            int debut = time; // les sommets de cette composante ont d > debut
+            DFS_visit(G, i, d, f, p, &time, color);
+            for (int j = i; j < G->n; j++) { // les sommets avant i sont deja marques
+                if (c[j] == -1 && color[j] == 2 && d[j] > debut) {
+                    c[j] = component_id;
+                }
+            }
+            component_id++;
+        }
+    }
+    free(color);
+}
+
+// ---------------------------------------------------------------------------
+// permutations: perm[ancien] = nouveau
+// ---------------------------------------------------------------------------
+
+// degre de chaque sommet (degre sortant, pour non oriente c'est le degre)
+void calcul_degres(Graphe *G, int *deg) {
+    for (int i = 0; i < G->n; i++) {
+        deg[i] = longueur_liste(G->listes[i]);
+    }
+}
+
+int comparer_degre_decroissant(const void *a, const void *b) {
+    const SommetDegre *x = (const SommetDegre *)a;
+    const SommetDegre *y = (const SommetDegre *)b;
+    if (x->degre != y->degre) {
+        return y->degre - x->degre; // degre le plus grand d'abord
+    }
+    return x->id - y->id; // a degre egal on garde l'ordre d'origine (tri stable)
+}
+
+int comparer_degre_croissant(const void *a, const void *b) {
+    const SommetDegre *x = (const SommetDegre *)a;
+    const SommetDegre *y = (const SommetDegre *)b;
+    if (x->degre != y->degre) {
+        return x->degre - y->degre;
+    }
+    return x->id - y->id;
+}
+
+// les sommets de grand degre (les plus visites) sont regroupes au debut du tableau
+void permutation_degre(Graphe *G, int *perm) {
+    int *deg = (int *)malloc(G->n * sizeof(int));
+    SommetDegre *tab = (SommetDegre *)malloc(G->n * sizeof(SommetDegre));
+    calcul_degres(G, deg);
+    for (int i = 0; i < G->n; i++) {
+        tab[i].id = i;
+        tab[i].degre = deg[i];
+    }
+    qsort(tab, G->n, sizeof(SommetDegre), comparer_degre_decroissant);
+    for (int k = 0; k < G->n; k++) {
+        perm[tab[k].id] = k;
+    }
+    free(tab);
+    free(deg);
+}
+
+// BFS a partir de source dans la file, les voisins sont ajoutes dans l'ordre de la liste
+// (ou par degre croissant si par_degre), les sommets marques recoivent leur rang dans ordre
+// retourne le nombre de sommets places dans ordre
+int bfs_ordre(Graphe *G, int source, int *ordre, int k, bool *vu, int *deg, bool par_degre, SommetDegre *voisins) {
+    int tete = k;
+    ordre[k++] = source;
+    vu[source] = true;
+    while (tete < k) {
+        int u = ordre[tete++];
+        int nb = 0;
+        Noeud *current = G->listes[u];
+        while (current != NULL) {
+            int v = current->s.id;
+            if (!vu[v]) {
+                vu[v] = true;
+                voisins[nb].id = v;
+                voisins[nb].degre = deg[v];
+                nb++;
+            }
+            current = current->suivant;
+        }
+        if (par_degre) {
+            qsort(voisins, nb, sizeof(SommetDegre), comparer_degre_croissant);
+        }
+        for (int j = 0; j < nb; j++) {
+            ordre[k++] = voisins[j].id;
+        }
+    }
+    return k;
+}
+
+// ordre BFS: a partir de source puis des sommets non atteints (par ordre d'id)
+// les sommets voisins dans le graphe deviennent voisins en memoire
+void permutation_bfs(Graphe *G, int source, int *perm) {
+    int *ordre = (int *)malloc(G->n * sizeof(int));
+    int *deg = (int *)malloc(G->n * sizeof(int));
+    bool *vu = (bool *)calloc(G->n, sizeof(bool));
+    SommetDegre *voisins = (SommetDegre *)malloc(G->n * sizeof(SommetDegre));
+    calcul_degres(G, deg);
+    int k = bfs_ordre(G, source, ordre, 0, vu, deg, false, voisins);
+    for (int i = 0; i < G->n; i++) {
+        if (!vu[i]) {
+            k = bfs_ordre(G, i, ordre, k, vu, deg, false, voisins);
+        }
+    }
+    for (int i = 0; i < G->n; i++) {
+        perm[ordre[i]] = i;
+    }
+    free(voisins);
+    free(vu);
+    free(deg);
+    free(ordre);
+}
+
+// Cuthill-McKee inverse (RCM): pour chaque composante on part d'un sommet de degre minimal,
+// BFS avec les voisins par degre croissant, puis on inverse l'ordre obtenu
+// -> reduit la largeur de bande de la matrice d'adjacence
+void permutation_rcm(Graphe *G, int *perm) {
+    int *ordre = (int *)malloc(G->n * sizeof(int));
+    int *deg = (int *)malloc(G->n * sizeof(int));
+    bool *vu = (bool *)calloc(G->n, sizeof(bool));
+    SommetDegre *voisins = (SommetDegre *)malloc(G->n * sizeof(SommetDegre));
+    SommetDegre *tab = (SommetDegre *)malloc(G->n * sizeof(SommetDegre));
+    calcul_degres(G, deg);
+    for (int i = 0; i < G->n; i++) {
+        tab[i].id = i;
+        tab[i].degre = deg[i];
+    }
+    qsort(tab, G->n, sizeof(SommetDegre), comparer_degre_croissant);
+    int k = 0;
+    for (int i = 0; i < G->n; i++) { // sommet de depart = plus petit degre non encore vu
+        if (!vu[tab[i].id]) {
+            k = bfs_ordre(G, tab[i].id, ordre, k, vu, deg, true, voisins);
+        }
+    }
+    for (int i = 0; i < G->n; i++) {
+        perm[ordre[i]] = G->n - 1 - i; // inverse
+    }
+    free(tab);
+    free(voisins);
+    free(vu);
+    free(deg);
+    free(ordre);
+}
+
+// inv[nouveau] = ancien
+void inverser_permutation(int *perm, int *inv, int n) {
+    for (int i = 0; i < n; i++) {
+        inv[perm[i]] = i;
+    }
+}
+
+int comparer_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// construire GR = G renumerote selon perm
+// les noeuds sont alloues dans l'ordre des nouveaux ids et chaque liste est triee
+// par id croissant -> DFS_visit lit la memoire presque sequentiellement
+void renumeroter(Graphe *GR, Graphe *G, int *perm, int *inv) {
+    init_graphe(GR, G->n, G->oriente);
+    int *voisins = (int *)malloc(G->n * sizeof(int));
+    for (int u = 0; u < G->n; u++) { // u = nouvel id
+        int ancien = inv[u];
+        int nb = 0;
+        Noeud *current = G->listes[ancien];
+        while (current != NULL) {
+            voisins[nb++] = perm[current->s.id];
+            current = current->suivant;
+        }
+        qsort(voisins, nb, sizeof(int), comparer_int);
+        for (int j = nb - 1; j >= 0; j--) { // insertion en tete -> on part de la fin
+            ajouterArc(GR, u, voisins[j]); // pas de lien_existe: G n'a pas de doublon
+        }
+    }
+    GR->m = G->m; // chaque arete non orientee a ete ajoutee 2 fois par ajouterArc
+    free(voisins);
+}
+
+// ---------------------------------------------------------------------------
+// retour aux ids d'origine
+// ---------------------------------------------------------------------------
+
+// t est indexe par nouvel id -> res indexe par ancien id (d, f, c)
+void restaurer_tableau(int *res, int *t, int *perm, int n) {
+    for (int i = 0; i < n; i++) {
+        res[i] = t[perm[i]];
+    }
+}
+
+// comme restaurer_tableau, mais les valeurs sont aussi des sommets (p)
+void restaurer_predecesseurs(int *res, int *p, int *perm, int *inv, int n) {
+    for (int i = 0; i < n; i++) {
+        int v = p[perm[i]];
+        res[i] = (v == -1) ? -1 : inv[v];
+    }
+}
+
+int main(){
+    Graphe g;
+    charge(&g, "mon_graphe.txt");
+    printf("Graphe original:\n");
+    afficher_simple(&g);
+
+    printf("\nRenumerotation: degre decroissant (0), Cuthill-McKee inverse (1), BFS (2): ");
+    int methode;
+    scanf("%d", &methode);
+    printf("Entrer sommet source: ");
+    int id;
+    scanf("%d", &id);
+    if (id < 0 || id >= g.n) {
+        printf("Sommet invalide\n");
+        liberer_graphe(&g);
+        return 1;
+    }
+
+    int n = g.n;
+    int *perm = (int *)malloc(n * sizeof(int));
+    int *inv = (int *)malloc(n * sizeof(int));
+    if (methode == 0) {
+        permutation_degre(&g, perm);
+    } else if (methode == 1) {
+        permutation_rcm(&g, perm);
+    } else {
+        permutation_bfs(&g, id, perm);
+    }
+    inverser_permutation(perm, inv, n);
+
+    printf("\nPermutation (ancien -> nouveau):\n");
+    for (int i = 0; i < n; i++) {
+        printf("%d -> %d\n", i, perm[i]);
+    }
+
+    Graphe gr;
+    renumeroter(&gr, &g, perm, inv);
+    printf("\nGraphe renumerote:\n");
+    afficher_simple(&gr);
+
+    // parcours sur le graphe renumerote, resultat affiche avec les ids d'origine
+    int *d = (int *)malloc(n * sizeof(int));
+    int *f = (int *)malloc(n * sizeof(int));
+    int *p = (int *)malloc(n * sizeof(int));
+    int *c = (int *)malloc(n * sizeof(int));
+    int *res_d = (int *)malloc(n * sizeof(int));
+    int *res_f = (int *)malloc(n * sizeof(int));
+    int *res_p = (int *)malloc(n * sizeof(int));
+    int *res_c = (int *)malloc(n * sizeof(int));
+
+    parcours(&gr, perm[id], d, f, p);
+    restaurer_tableau(res_d, d, perm, n);
+    restaurer_tableau(res_f, f, perm, n);
+    restaurer_predecesseurs(res_p, p, perm, inv, n);
+    printf("\nParcours (ids d'origine):\n");
+    afficher_parcours(id, res_d, res_f, res_p, n);
+
+    composantes(&gr, 0, d, f, p, c);
+    restaurer_tableau(res_c, c, perm, n);
+    printf("\nComposantes connexes (ids d'origine):\n");
+    for (int i = 0; i < n; i++) {
+        printf("Sommet %d: Composante %d\n", i, res_c[i]);
+    }
+
+    free(d); free(f); free(p); free(c);
+    free(res_d); free(res_f); free(res_p); free(res_c);
+    free(perm);
+    free(inv);
+    liberer_graphe(&gr);
+    liberer_graphe(&g);
+    return 0;
+}
@@ -0,0 +1,626 @@
+// representation compressee en lecture seule d'un graphe: voisins tries, codes par
+// ecarts (delta) puis en entiers de taille variable (varint), avec un iterateur
+// utilise par le parcours en profondeur, les degres et le sous graphe. Le graphe compresse
+// peut etre construit directement depuis le fichier, sans les listes chainees.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+void afficher_parcours(int id, int *d, int *f, int *p, int n) {
+    printf("Sommet\tDecouverte\tFin\tPredecesseur\n");
+    for (int i = 0; i < n; i++) {
+        if(i != id && p[i] == -1) continue; // si sommet n'est pas accessible
+        printf("%d\t%d\t\t%d\t%d\n", i, d[i], f[i], p[i]);
+    }
+}
+
+int comparer_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// ---------------------------------------------------------------------------
+// representation compressee (lecture seule)
+// pour chaque sommet u, un bloc d'octets:
+//   degre de u (varint)
+//   premier voisin v0 code par zigzag(v0 - u) (varint), car souvent proche de u
+//   puis les ecarts v(k) - v(k-1) - 1 (varint), voisins tries et sans doublon
+// varint: 7 bits de donnee par octet, bit de poids fort = 1 s'il reste des octets
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    bool oriente;
+    int n; // nombre de sommets
+    int64_t m; // nombre d'aretes (arcs), comme g->m
+    int64_t *debut; // debut[u] = position du bloc de u dans octets, debut[n] = taille totale
+    unsigned char *octets; // tous les blocs a la suite
+} GrapheCompresse;
+
+// iterateur sur les voisins d'un sommet
+typedef struct {
+    const unsigned char *pos; // prochain octet a lire
+    int restant; // nombre de voisins pas encore lus
+    int courant; // dernier voisin lu (au depart: u, pour decoder le premier ecart)
+    bool premier; // true tant que le premier voisin n'est pas lu
+} IterateurVoisins;
+
+// ecrit x en varint dans buf, retourne le nombre d'octets ecrits (au plus 5)
+int ecrire_varint(unsigned char *buf, unsigned int x) {
+    int k = 0;
+    while (x >= 0x80) {
+        buf[k++] = (unsigned char)(x | 0x80);
+        x >>= 7;
+    }
+    buf[k++] = (unsigned char)x;
+    return k;
+}
+
+// lit un varint a partir de *pos et avance *pos
+static inline unsigned int lire_varint(const unsigned char **pos) {
+    const unsigned char *p = *pos;
+    unsigned int x = *p & 0x7f;
+    if (*p++ & 0x80) { // cas frequent (1 octet) traite sans boucle
+        int decalage = 7;
+        do {
+            x |= (unsigned int)(*p & 0x7f) << decalage;
+            decalage += 7;
+        } while (*p++ & 0x80);
+    }
+    *pos = p;
+    return x;
+}
+
+// zigzag: entier signe -> non signe (0, -1, 1, -2 ... -> 0, 1, 2, 3 ...)
+unsigned int zigzag(int x) {
+    return ((unsigned int)x << 1) ^ (unsigned int)(x >> 31);
+}
+
+static inline int dezigzag(unsigned int x) {
+    return (int)(x >> 1) ^ -(int)(x & 1);
+}
+
+// construire la version compressee GC du graphe G
+void compresser(GrapheCompresse *GC, Graphe *G) {
+    GC->oriente = G->oriente;
+    GC->n = G->n;
+    GC->m = G->m;
+    GC->debut = (int64_t *)malloc((G->n + 1) * sizeof(int64_t));
+
+    int *voisins = (int *)malloc(G->n * sizeof(int));
+    // 1er passage: taille exacte de chaque bloc
+    int64_t taille = 0;
+    unsigned char tmp[5];
+    for (int u = 0; u < G->n; u++) {
+        GC->debut[u] = taille;
+        int nb = 0;
+        Noeud *current = G->listes[u];
+        while (current != NULL) {
+            voisins[nb++] = current->s.id;
+            current = current->suivant;
+        }
+        qsort(voisins, nb, sizeof(int), comparer_int);
+        taille += ecrire_varint(tmp, nb);
+        for (int k = 0; k < nb; k++) {
+            unsigned int code = (k == 0) ? zigzag(voisins[0] - u) : (unsigned int)(voisins[k] - voisins[k - 1] - 1);
+            taille += ecrire_varint(tmp, code);
+        }
+    }
+    GC->debut[G->n] = taille;
+
+    // 2e passage: ecriture des blocs
+    GC->octets = (unsigned char *)malloc(taille > 0 ? taille : 1);
+    for (int u = 0; u < G->n; u++) {
+        unsigned char *buf = GC->octets + GC->debut[u];
+        int nb = 0;
+        Noeud *current = G->listes[u];
+        while (current != NULL) {
+            voisins[nb++] = current->s.id;
+            current = current->suivant;
+        }
+        qsort(voisins, nb, sizeof(int), comparer_int);
+        buf += ecrire_varint(buf, nb);
+        for (int k = 0; k < nb; k++) {
+            unsigned int code = (k == 0) ? zigzag(voisins[0] - u) : (unsigned int)(voisins[k] - voisins[k - 1] - 1);
+            buf += ecrire_varint(buf, code);
+        }
+    }
+    free(voisins);
+}
+
+// lit le prochain lien du fichier, false a la fin (ou si le fichier est invalide)
+bool lire_lien(FILE *fichier, int *id1, int *id2) {
+    return fscanf(fichier, "%d %d", id1, id2) == 2;
+}
+
+// ajoute le bloc de u (voisins[0..nb) tries, sans doublon) a la fin de GC->octets
+void ajouter_bloc(GrapheCompresse *GC, int64_t *capacite, int u, int *voisins, int nb) {
+    int64_t taille = GC->debut[u];
+    if (taille + (int64_t)5 * (nb + 1) > *capacite) { // au plus 5 octets par varint
+        while (taille + (int64_t)5 * (nb + 1) > *capacite) {
+            *capacite *= 2;
+        }
+        GC->octets = (unsigned char *)realloc(GC->octets, *capacite);
+    }
+    unsigned char *buf = GC->octets + taille;
+    buf += ecrire_varint(buf, nb);
+    for (int k = 0; k < nb; k++) {
+        unsigned int code = (k == 0) ? zigzag(voisins[0] - u) : (unsigned int)(voisins[k] - voisins[k - 1] - 1);
+        buf += ecrire_varint(buf, code);
+    }
+    GC->debut[u + 1] = buf - GC->octets;
+}
+
+// construire GC directement a partir du fichier (meme format que charge), sans passer
+// par les listes chainees:
+// 1. une lecture du fichier pour compter les voisins de chaque sommet
+// 2. les sommets sont pris par plages dont les voisins tiennent dans budget entiers;
+//    pour chaque plage on relit le fichier, on range les voisins de la plage, on les
+//    trie, enleve les doublons et on code les blocs a la suite
+// la memoire de travail est donc 4 octets par sommet (degres) + budget entiers, au lieu
+// d'un Noeud de 16 octets par voisin
+// retourne le pic de memoire utilise (en octets), -1 en cas d'erreur
+int64_t charge_compresse(GrapheCompresse *GC, const char *nom_fichier, int64_t budget) {
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return -1;
+    }
+    int n, m, oriente;
+    if (fscanf(fichier, "%d %d %d", &oriente, &n, &m) != 3 || n < 0) {
+        printf("Erreur: entete invalide\n");
+        fclose(fichier);
+        return -1;
+    }
+    fpos_t debut_liens; // fgetpos/fsetpos: pas limite a 2 Go comme ftell sur un long
+    if (fgetpos(fichier, &debut_liens) != 0) {
+        printf("Erreur: position dans le fichier\n");
+        fclose(fichier);
+        return -1;
+    }
+    if (budget < 1) budget = 1;
+    if (budget > 0x7fffffff) budget = 0x7fffffff; // positions dans la plage en int
+
+    // 1. degres (avec les doublons eventuels: c'est une borne)
+    int *deg = (int *)calloc(n > 0 ? n : 1, sizeof(int));
+    int id1, id2;
+    for (int i = 0; i < m && lire_lien(fichier, &id1, &id2); i++) {
+        if (id1 < 0 || id1 >= n || id2 < 0 || id2 >= n) {
+            continue; // lien invalide ignore
+        }
+        deg[id1]++;
+        if (!oriente && id1 != id2) {
+            deg[id2]++;
+        }
+    }
+
+    GC->oriente = oriente;
+    GC->n = n;
+    GC->debut = (int64_t *)malloc((n + 1) * sizeof(int64_t));
+    GC->debut[0] = 0;
+    int64_t capacite = 64;
+    GC->octets = (unsigned char *)malloc(capacite);
+    int *place = (int *)malloc((n + 1) * sizeof(int)); // curseur d'ecriture de chaque sommet dans la plage
+    int64_t total = 0;
+    for (int u = 0; u < n; u++) {
+        total += deg[u];
+    }
+    int64_t taille_voisins = total < budget ? (total > 0 ? total : 1) : budget;
+    int *voisins = (int *)malloc(taille_voisins * sizeof(int));
+    int64_t entrees = 0, boucles = 0;
+
+    // 2. plages de sommets [a, b)
+    for (int a = 0; a < n; ) {
+        int b = a;
+        int64_t cumul = 0;
+        while (b < n && (b == a || cumul + deg[b] <= budget)) {
+            cumul += deg[b];
+            b++;
+        }
+        if (cumul > taille_voisins) { // un seul sommet a plus de budget voisins
+            taille_voisins = cumul;
+            voisins = (int *)realloc(voisins, taille_voisins * sizeof(int));
+        }
+        place[a] = 0;
+        for (int u = a; u < b; u++) {
+            place[u + 1] = place[u] + deg[u];
+        }
+
+        fsetpos(fichier, &debut_liens);
+        for (int i = 0; i < m && lire_lien(fichier, &id1, &id2); i++) {
+            if (id1 < 0 || id1 >= n || id2 < 0 || id2 >= n) {
+                continue;
+            }
+            if (id1 >= a && id1 < b) {
+                voisins[place[id1]++] = id2;
+            }
+            if (!oriente && id1 != id2 && id2 >= a && id2 < b) {
+                voisins[place[id2]++] = id1;
+            }
+        }
+
+        // apres remplissage, place[u] = fin des voisins de u = debut de ceux de u + 1
+        for (int u = a; u < b; u++) {
+            int debut = (u == a) ? 0 : place[u - 1];
+            int nb = (int)(place[u] - debut);
+            int *vu = voisins + debut;
+            qsort(vu, nb, sizeof(int), comparer_int);
+            int distincts = 0;
+            for (int k = 0; k < nb; k++) { // enlever les doublons (comme ajout_lien)
+                if (distincts == 0 || vu[k] != vu[distincts - 1]) {
+                    vu[distincts++] = vu[k];
+                }
+            }
+            entrees += distincts;
+            if (distincts > 0 && vu[0] <= u && bsearch(&u, vu, distincts, sizeof(int), comparer_int) != NULL) {
+                boucles++;
+            }
+            ajouter_bloc(GC, &capacite, u, vu, distincts);
+        }
+        a = b;
+    }
+    fclose(fichier);
+
+    // meme convention que g->m: une arete non orientee compte une fois, boucle comprise
+    GC->m = oriente ? entrees : (entrees + boucles) / 2;
+    int64_t pic = (int64_t)n * sizeof(int) + (int64_t)(n + 1) * (sizeof(int) + sizeof(int64_t))
+             + taille_voisins * sizeof(int) + capacite;
+    GC->octets = (unsigned char *)realloc(GC->octets, GC->debut[n] > 0 ? GC->debut[n] : 1);
+    free(voisins);
+    free(place);
+    free(deg);
+    return pic;
+}
+
+void liberer_compresse(GrapheCompresse *GC) {
+    free(GC->debut);
+    free(GC->octets);
+}
+
+// place l'iterateur au debut des voisins de u
+static inline void iter_debut(GrapheCompresse *GC, int u, IterateurVoisins *it) {
+    it->pos = GC->octets + GC->debut[u];
+    it->restant = (int)lire_varint(&it->pos);
+    it->courant = u;
+    it->premier = true;
+}
+
+// met le prochain voisin dans *v, retourne false quand il n'y en a plus
+// (les voisins sortent par id croissant)
+static inline bool iter_suivant(IterateurVoisins *it, int *v) {
+    if (it->restant == 0) {
+        return false;
+    }
+    unsigned int code = lire_varint(&it->pos);
+    if (it->premier) {
+        it->courant += dezigzag(code); // v0 = u + (v0 - u)
+        it->premier = false;
+    } else {
+        it->courant += (int)code + 1;
+    }
+    it->restant--;
+    *v = it->courant;
+    return true;
+}
+
+// degre sortant de u: lu directement dans l'entete du bloc
+int degre_compresse(GrapheCompresse *GC, int u) {
+    const unsigned char *pos = GC->octets + GC->debut[u];
+    return (int)lire_varint(&pos);
+}
+
+bool lien_existe_compresse(GrapheCompresse *GC, int id1, int id2) {
+    IterateurVoisins it;
+    int v;
+    iter_debut(GC, id1, &it);
+    while (iter_suivant(&it, &v)) {
+        if (v >= id2) { // voisins tries: on peut s'arreter des qu'on depasse id2
+            return v == id2;
+        }
+    }
+    return false;
+}
+
+void degres_compresse(GrapheCompresse *GC, int *de, int *dg) {
+    for (int i = 0; i < GC->n; i++) {
+        dg[i] = degre_compresse(GC, i); // degre sortant
+        de[i] = 0;
+    }
+    if (GC->oriente) {
+        IterateurVoisins it;
+        int v;
+        for (int i = 0; i < GC->n; i++) {
+            iter_debut(GC, i, &it);
+            while (iter_suivant(&it, &v)) {
+                de[v]++;
+            }
+        }
+    } else {
+        for (int i = 0; i < GC->n; i++) {
+            de[i] = dg[i]; // pour un graphe non orienté, degré entrant = degré sortant
+        }
+    }
+}
+
+// meme DFS que DFS_visit mais en lisant les voisins dans GC
+void DFS_visit_compresse(GrapheCompresse *G, int u, int *d, int *f, int *p, int *time, int *color) {
+    color[u] = 1; // gris
+    d[u] = ++(*time);
+    IterateurVoisins it;
+    int v;
+    iter_debut(G, u, &it);
+    while (iter_suivant(&it, &v)) {
+        if (color[v] == 0) { // blanc
+            p[v] = u;
+            DFS_visit_compresse(G, v, d, f, p, time, color);
+        }
+    }
+    color[u] = 2; // noir
+    f[u] = ++(*time);
+}
+
+void parcours_compresse(GrapheCompresse *G, int id, int *d, int *f, int *p) {
+    int *color = (int *)malloc(G->n * sizeof(int)); // 0: blanc, 1: gris, 2: noir
+    for (int i = 0; i < G->n; i++) {
+        color[i] = 0;
+        p[i] = -1;
+    }
+    int time = 0;
+    DFS_visit_compresse(G, id, d, f, p, &time, color);
+    free(color);
+}
+
+// sous graphe SG (non compresse) de GC induit par les nb sommets de S
+// les sommets de S sont renumerotes 0..nb-1 dans SG (SG a nb sommets)
+void sous_graphe_compresse(Graphe *SG, GrapheCompresse *GC, int nb, Sommet *S) {
+    init_graphe(SG, nb, GC->oriente);
+    int *indice = (int *)malloc(GC->n * sizeof(int)); // indice[v] = position de v dans S, -1 sinon
+    for (int i = 0; i < GC->n; i++) {
+        indice[i] = -1;
+    }
+    for (int i = 0; i < nb; i++) {
+        indice[S[i].id] = i;
+    }
+    IterateurVoisins it;
+    int v;
+    for (int i = 0; i < nb; i++) {
+        iter_debut(GC, S[i].id, &it);
+        while (iter_suivant(&it, &v)) {
+            int j = indice[v];
+            if (j != -1 && (GC->oriente || i <= j)) { // non oriente: chaque arete une seule fois
+                if (GC->oriente) {
+                    ajouterArc(SG, i, j);
+                } else {
+                    ajouterArete(SG, i, j);
+                }
+            }
+        }
+    }
+    free(indice);
+}
+
+void afficher_compresse(GrapheCompresse *GC) {
+    printf("Nombre de sommets: %d\n", GC->n);
+    printf("Nombre de connexions: %" PRId64 "\n", GC->m);
+    printf("Type: %s\n", GC->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    IterateurVoisins it;
+    int v;
+    for (int i = 0; i < GC->n; i++) {
+        if (degre_compresse(GC, i) > 0) {
+            printf("Sommet %d: ", i);
+            iter_debut(GC, i, &it);
+            while (iter_suivant(&it, &v)) {
+                printf("%d -> ", v);
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+// memoire occupee par la version compressee, comparee a celle des listes chainees pour
+// le meme graphe (un Noeud par voisin) et au pic de memoire du chargement
+void afficher_memoire(GrapheCompresse *GC, int64_t pic) {
+    int64_t entrees = 0; // nombre de voisins (une arete non orientee = 2 voisins)
+    for (int i = 0; i < GC->n; i++) {
+        entrees += degre_compresse(GC, i);
+    }
+    int64_t listes = entrees * sizeof(Noeud) + GC->n * sizeof(Liste);
+    int64_t compresse = GC->debut[GC->n] + (GC->n + 1) * sizeof(int64_t);
+    printf("Listes chainees (equivalent): %" PRId64 " octets\n", listes);
+    printf("Compresse: %" PRId64 " octets (%" PRId64 " octets de voisins)\n", compresse, GC->debut[GC->n]);
+    printf("Pic de memoire du chargement: %" PRId64 " octets\n", pic);
+    if (entrees > 0) {
+        printf("Octets par voisin: %.2f (listes) / %.2f (compresse)\n",
+               (double)sizeof(Noeud), (double)GC->debut[GC->n] / entrees);
+    }
+}
+
+#define BUDGET_CHARGEMENT ((int64_t)1 << 24) // voisins en memoire par plage (64 Mo)
+
+int main(){
+    GrapheCompresse gc;
+    int64_t pic = charge_compresse(&gc, "mon_graphe.txt", BUDGET_CHARGEMENT);
+    if (pic < 0) {
+        return 1;
+    }
+    printf("Graphe compresse:\n");
+    afficher_compresse(&gc);
+    printf("\n");
+    afficher_memoire(&gc, pic);
+
+    int n = gc.n;
+    int *de = (int *)malloc(n * sizeof(int));
+    int *dg = (int *)malloc(n * sizeof(int));
+    degres_compresse(&gc, de, dg);
+    printf("\n");
+    for (int i = 0; i < n; i++) {
+        printf("Sommet %d: degre entrant = %d, degre sortant = %d\n", i, de[i], dg[i]);
+    }
+
+    printf("\nEntrer sommet source: ");
+    int id;
+    scanf("%d", &id);
+    if (id >= 0 && id < n) {
+        int *d = (int *)malloc(n * sizeof(int));
+        int *f = (int *)malloc(n * sizeof(int));
+        int *p = (int *)malloc(n * sizeof(int));
+        parcours_compresse(&gc, id, d, f, p);
+        afficher_parcours(id, d, f, p, n);
+        free(d);
+        free(f);
+        free(p);
+    }
+
+    Graphe SG;
+    Sommet S[3] = {{0}, {2}, {3}};
+    sous_graphe_compresse(&SG, &gc, 3, S);
+    printf("\nSous graphe (0, 2, 3 -> 0, 1, 2):\n");
+    afficher_simple(&SG);
+
+    free(de);
+    free(dg);
+    liberer_graphe(&SG);
+    liberer_compresse(&gc);
+    return 0;
+}
@@ -0,0 +1,592 @@
+// chargement et sauvegarde en pipeline avec plusieurs threads: le fichier est coupe en
+// blocs alignes sur les fins de ligne, analyses (ou formates) en parallele pendant que
+// le disque est lu (ou ecrit).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+void sauvegarder(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "w");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    fprintf(fichier, "%d %d %d\n", g->oriente, g->n, g->m);
+    for (int i = 0; i < g->n; i++) {
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            if (g->oriente || i < current->s.id) { // prevent duplication in non or graph
+                fprintf(fichier, "%d %d\n", i, current->s.id);
+            }
+            current = current->suivant;
+        }
+    }
+    fclose(fichier);
+}
+
+// ---------------------------------------------------------------------------
+// E/S en pipeline
+// le fichier est coupe en blocs alignes sur les fins de ligne, chaque bloc passe par
+// une case d'un anneau de NB_CASES cases: LIBRE -> PLEIN -> PRET -> LIBRE
+// - charge: un thread lit les blocs, les workers les analysent, le thread principal
+//   ajoute les liens dans l'ordre du fichier
+// - sauvegarder: les workers formatent des plages de sommets, le thread principal
+//   ecrit les blocs dans l'ordre
+// lecture/ecriture disque et analyse/formatage se font donc en meme temps
+// ---------------------------------------------------------------------------
+
+#define TAILLE_BLOC (1 << 20) // 1 Mo de texte par bloc
+#define NB_CASES 16
+#define MAX_THREADS 64
+
+enum { LIBRE, PLEIN, PRET };
+
+typedef struct {
+    int etat;
+    char *texte; // texte du bloc (charge) ou texte formate (sauvegarder)
+    long taille; // nombre d'octets utiles dans texte
+    int *liens; // paires id1 id2 analysees (charge)
+    long nb_liens;
+    int debut, fin; // plage de sommets [debut, fin) (sauvegarder)
+} Case;
+
+typedef struct {
+    pthread_mutex_t verrou;
+    pthread_cond_t signal; // un seul signal, on reveille tout le monde (broadcast)
+    Case cases[NB_CASES];
+    long nb_blocs; // blocs lus (charge) ou nombre total de blocs (sauvegarder)
+    long prochain; // prochain bloc a traiter par un worker
+    long consommes; // blocs deja traites par le thread principal
+    bool fin_lecture; // plus de bloc a lire
+    bool erreur; // fichier invalide (ligne trop longue, entier negatif ou caractere inattendu)
+    FILE *fichier; // charge
+    Graphe *g; // sauvegarder
+    int *bornes; // sauvegarder: bloc k = sommets [bornes[k], bornes[k+1])
+} Pipeline;
+
+void init_pipeline(Pipeline *pl) {
+    pthread_mutex_init(&pl->verrou, NULL);
+    pthread_cond_init(&pl->signal, NULL);
+    for (int k = 0; k < NB_CASES; k++) {
+        pl->cases[k].etat = LIBRE;
+        pl->cases[k].texte = NULL;
+        pl->cases[k].taille = 0;
+        pl->cases[k].liens = NULL;
+        pl->cases[k].nb_liens = 0;
+    }
+    pl->nb_blocs = 0;
+    pl->prochain = 0;
+    pl->consommes = 0;
+    pl->fin_lecture = false;
+    pl->erreur = false;
+    pl->fichier = NULL;
+    pl->g = NULL;
+    pl->bornes = NULL;
+}
+
+void detruire_pipeline(Pipeline *pl) {
+    for (int k = 0; k < NB_CASES; k++) {
+        free(pl->cases[k].texte);
+        free(pl->cases[k].liens);
+    }
+    pthread_mutex_destroy(&pl->verrou);
+    pthread_cond_destroy(&pl->signal);
+}
+
+// analyse des entiers non negatifs a la main: pas de locale, pas de format a interpreter
+// retourne le nombre d'entiers lus dans [texte, texte + taille), -1 si le texte contient
+// autre chose que des chiffres et des blancs (par ex. un id negatif) ou un entier trop grand
+long analyser_entiers(const char *texte, long taille, int *sortie) {
+    long nb = 0;
+    long i = 0;
+    while (i < taille) {
+        while (i < taille && (texte[i] == ' ' || texte[i] == '\t' || texte[i] == '\r' || texte[i] == '\n')) {
+            i++;
+        }
+        if (i == taille) {
+            break;
+        }
+        if (texte[i] < '0' || texte[i] > '9') {
+            return -1;
+        }
+        int x = 0;
+        while (i < taille && texte[i] >= '0' && texte[i] <= '9') {
+            int chiffre = texte[i] - '0';
+            if (x > (INT_MAX - chiffre) / 10) { // teste avant de multiplier: pas de depassement
+                return -1;
+            }
+            x = x * 10 + chiffre;
+            i++;
+        }
+        sortie[nb++] = x;
+    }
+    return nb;
+}
+
+// thread de lecture: remplit les cases avec des blocs qui finissent par '\n'
+// le morceau de ligne apres le dernier '\n' est reporte au debut du bloc suivant
+void *thread_lecture(void *arg) {
+    Pipeline *pl = (Pipeline *)arg;
+    char *reste = (char *)malloc(TAILLE_BLOC);
+    long taille_reste = 0;
+    long k = 0; // numero du prochain bloc, avance seulement quand un bloc est produit
+    while (true) {
+        Case *c = &pl->cases[k % NB_CASES];
+        pthread_mutex_lock(&pl->verrou);
+        while (c->etat != LIBRE) {
+            pthread_cond_wait(&pl->signal, &pl->verrou);
+        }
+        pthread_mutex_unlock(&pl->verrou);
+
+        if (c->texte == NULL) {
+            c->texte = (char *)malloc(2 * TAILLE_BLOC); // reste (< TAILLE_BLOC) + lecture
+        }
+        memcpy(c->texte, reste, taille_reste);
+        long lus = (long)fread(c->texte + taille_reste, 1, TAILLE_BLOC, pl->fichier);
+        long total = taille_reste + lus;
+        long coupe = total;
+        bool fin = lus < TAILLE_BLOC;
+        if (!fin) { // pas a la fin du fichier: couper apres le dernier '\n'
+            while (coupe > 0 && c->texte[coupe - 1] != '\n') {
+                coupe--;
+            }
+        }
+        taille_reste = total - coupe;
+        bool erreur = !fin && (coupe == 0 || taille_reste >= TAILLE_BLOC); // ligne plus longue qu'un bloc
+        if (!erreur) {
+            memcpy(reste, c->texte + coupe, taille_reste);
+            c->taille = coupe;
+        }
+
+        pthread_mutex_lock(&pl->verrou);
+        if (erreur) {
+            pl->erreur = true;
+        } else if (coupe > 0) {
+            c->etat = PLEIN;
+            pl->nb_blocs++;
+            k++;
+        }
+        if (fin || erreur) {
+            pl->fin_lecture = true;
+        }
+        pthread_cond_broadcast(&pl->signal);
+        pthread_mutex_unlock(&pl->verrou);
+        if (fin || erreur) {
+            break;
+        }
+    }
+    free(reste);
+    return NULL;
+}
+
+// worker de charge: transforme le texte d'un bloc en tableau de liens
+void *thread_analyse(void *arg) {
+    Pipeline *pl = (Pipeline *)arg;
+    while (true) {
+        pthread_mutex_lock(&pl->verrou);
+        while (pl->prochain >= pl->nb_blocs && !pl->fin_lecture) {
+            pthread_cond_wait(&pl->signal, &pl->verrou);
+        }
+        if (pl->prochain >= pl->nb_blocs) { // fin_lecture et tout est pris
+            pthread_mutex_unlock(&pl->verrou);
+            return NULL;
+        }
+        long k = pl->prochain++;
+        pthread_mutex_unlock(&pl->verrou);
+
+        Case *c = &pl->cases[k % NB_CASES];
+        if (c->liens == NULL) {
+            c->liens = (int *)malloc(2 * TAILLE_BLOC * sizeof(int)); // au plus 1 entier pour 2 octets
+        }
+        long nb = analyser_entiers(c->texte, c->taille, c->liens);
+        c->nb_liens = (nb < 0 || nb % 2 != 0) ? -1 : nb / 2; // -1: bloc invalide
+
+        pthread_mutex_lock(&pl->verrou);
+        if (c->nb_liens < 0) {
+            pl->erreur = true;
+        }
+        c->etat = PRET;
+        pthread_cond_broadcast(&pl->signal);
+        pthread_mutex_unlock(&pl->verrou);
+    }
+}
+
+// comme charge, avec nb_threads threads d'analyse
+// les liens sont ajoutes dans l'ordre du fichier -> meme graphe qu'avec charge
+// un fichier invalide est refuse en entier: message d'erreur, g vide et retour false
+bool charge_parallele(Graphe *g, const char *nom_fichier, int nb_threads) {
+    FILE *fichier = fopen(nom_fichier, "rb");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        init_graphe(g, 0, false);
+        return false;
+    }
+    int n, m, oriente;
+    if (fscanf(fichier, "%d %d %d", &oriente, &n, &m) != 3 || n < 0) {
+        printf("Erreur: entete invalide\n");
+        fclose(fichier);
+        init_graphe(g, 0, false);
+        return false;
+    }
+    init_graphe(g, n, oriente);
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+
+    Pipeline pl;
+    init_pipeline(&pl);
+    pl.fichier = fichier;
+    pthread_t lecteur, workers[MAX_THREADS];
+    pthread_create(&lecteur, NULL, thread_lecture, &pl);
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_create(&workers[t], NULL, thread_analyse, &pl);
+    }
+
+    long ajoutes = 0;
+    for (long k = 0; ; k++) {
+        Case *c = &pl.cases[k % NB_CASES];
+        pthread_mutex_lock(&pl.verrou);
+        while (!(k < pl.nb_blocs && c->etat == PRET) && !(pl.fin_lecture && k >= pl.nb_blocs)) {
+            pthread_cond_wait(&pl.signal, &pl.verrou);
+        }
+        bool fini = (k >= pl.nb_blocs);
+        bool erreur = pl.erreur;
+        pthread_mutex_unlock(&pl.verrou);
+        if (fini) {
+            break;
+        }
+
+        // apres une erreur on continue a vider l'anneau (sans ajouter) pour arreter les threads
+        for (long i = 0; !erreur && i < c->nb_liens && ajoutes < m; i++, ajoutes++) {
+            int id1 = c->liens[2 * i], id2 = c->liens[2 * i + 1];
+            if (id1 < n && id2 < n) {
+                ajout_lien(g, id1, id2);
+            }
+        }
+
+        pthread_mutex_lock(&pl.verrou);
+        c->etat = LIBRE;
+        pl.consommes++;
+        pthread_cond_broadcast(&pl.signal);
+        pthread_mutex_unlock(&pl.verrou);
+    }
+
+    pthread_join(lecteur, NULL);
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    bool erreur = pl.erreur; // tous les threads sont termines
+    detruire_pipeline(&pl);
+    fclose(fichier);
+    if (erreur) {
+        printf("Erreur: fichier invalide (ligne trop longue, id negatif ou caractere inattendu)\n");
+        liberer_graphe(g);
+        init_graphe(g, 0, oriente);
+        return false;
+    }
+    return true;
+}
+
+// ecrit x en decimal dans buf (sans '\0'), retourne le nombre de caracteres
+// deux chiffres par iteration avec une table, au lieu de fprintf("%d")
+static const char DEUX_CHIFFRES[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+int entier_vers_texte(char *buf, int x) {
+    char tmp[12];
+    int k = 12;
+    unsigned int u = (x < 0) ? -(unsigned int)x : (unsigned int)x;
+    while (u >= 100) {
+        int r = u % 100;
+        u /= 100;
+        tmp[--k] = DEUX_CHIFFRES[2 * r + 1];
+        tmp[--k] = DEUX_CHIFFRES[2 * r];
+    }
+    if (u >= 10) {
+        tmp[--k] = DEUX_CHIFFRES[2 * u + 1];
+        tmp[--k] = DEUX_CHIFFRES[2 * u];
+    } else {
+        tmp[--k] = (char)('0' + u);
+    }
+    if (x < 0) {
+        tmp[--k] = '-';
+    }
+    memcpy(buf, tmp + k, 12 - k);
+    return 12 - k;
+}
+
+// worker de sauvegarde: formate les liens des sommets [debut, fin) d'un bloc
+void *thread_formatage(void *arg) {
+    Pipeline *pl = (Pipeline *)arg;
+    Graphe *g = pl->g;
+    while (true) {
+        pthread_mutex_lock(&pl->verrou);
+        // on ne prend un bloc que si sa case a ete liberee par l'ecriture
+        while (pl->prochain < pl->nb_blocs && pl->cases[pl->prochain % NB_CASES].etat != LIBRE) {
+            pthread_cond_wait(&pl->signal, &pl->verrou);
+        }
+        if (pl->prochain >= pl->nb_blocs) {
+            pthread_mutex_unlock(&pl->verrou);
+            return NULL;
+        }
+        long k = pl->prochain++;
+        Case *c = &pl->cases[k % NB_CASES];
+        c->etat = PLEIN; // reservee, en cours de formatage
+        pthread_mutex_unlock(&pl->verrou);
+
+        c->debut = pl->bornes[k];
+        c->fin = pl->bornes[k + 1];
+        long liens = 0;
+        for (int i = c->debut; i < c->fin; i++) {
+            liens += longueur_liste(g->listes[i]);
+        }
+        // au plus 2 * 11 caracteres + espace + '\n' par lien
+        c->texte = (char *)realloc(c->texte, liens * 24 + 1);
+        char *buf = c->texte;
+        for (int i = c->debut; i < c->fin; i++) {
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                if (g->oriente || i < current->s.id) { // prevent duplication in non or graph
+                    buf += entier_vers_texte(buf, i);
+                    *buf++ = ' ';
+                    buf += entier_vers_texte(buf, current->s.id);
+                    *buf++ = '\n';
+                }
+                current = current->suivant;
+            }
+        }
+        c->taille = buf - c->texte;
+
+        pthread_mutex_lock(&pl->verrou);
+        c->etat = PRET;
+        pthread_cond_broadcast(&pl->signal);
+        pthread_mutex_unlock(&pl->verrou);
+    }
+}
+
+// comme sauvegarder, avec nb_threads threads de formatage
+// les plages de sommets sont choisies pour avoir a peu pres le meme nombre de liens
+void sauvegarder_parallele(Graphe *g, const char *nom_fichier, int nb_threads) {
+    FILE *fichier = fopen(nom_fichier, "wb");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    fprintf(fichier, "%d %d %d\n", g->oriente, g->n, g->m);
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+
+    // decoupage: environ TAILLE_BLOC / 16 liens par bloc
+    const long liens_par_bloc = TAILLE_BLOC / 16;
+    int *bornes = (int *)malloc((g->n + 2) * sizeof(int));
+    long nb_blocs = 0;
+    long cumul = 0;
+    bornes[0] = 0;
+    for (int i = 0; i < g->n; i++) {
+        cumul += longueur_liste(g->listes[i]) + 1;
+        if (cumul >= liens_par_bloc) {
+            bornes[++nb_blocs] = i + 1;
+            cumul = 0;
+        }
+    }
+    if (bornes[nb_blocs] < g->n) {
+        bornes[++nb_blocs] = g->n;
+    }
+
+    Pipeline pl;
+    init_pipeline(&pl);
+    pl.g = g;
+    pl.bornes = bornes;
+    pl.nb_blocs = nb_blocs;
+    pthread_t workers[MAX_THREADS];
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_create(&workers[t], NULL, thread_formatage, &pl);
+    }
+
+    for (long k = 0; k < nb_blocs; k++) { // ecriture dans l'ordre
+        Case *c = &pl.cases[k % NB_CASES];
+        pthread_mutex_lock(&pl.verrou);
+        while (c->etat != PRET) {
+            pthread_cond_wait(&pl.signal, &pl.verrou);
+        }
+        pthread_mutex_unlock(&pl.verrou);
+
+        fwrite(c->texte, 1, c->taille, fichier);
+
+        pthread_mutex_lock(&pl.verrou);
+        c->etat = LIBRE;
+        pl.consommes++;
+        pthread_cond_broadcast(&pl.signal);
+        pthread_mutex_unlock(&pl.verrou);
+    }
+
+    for (int t = 0; t < nb_threads; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    detruire_pipeline(&pl);
+    free(bornes);
+    fclose(fichier);
+}
+
+int main(){
+    printf("Nombre de threads: ");
+    int nb_threads;
+    scanf("%d", &nb_threads);
+
+    Graphe g;
+    if (!charge_parallele(&g, "mon_graphe.txt", nb_threads)) {
+        liberer_graphe(&g);
+        return 1;
+    }
+    afficher_simple(&g);
+
+    sauvegarder_parallele(&g, "mon_graphe_copie.txt", nb_threads);
+    printf("Graphe sauvegarde dans mon_graphe_copie.txt\n");
+
+    liberer_graphe(&g);
+    return 0;
+}
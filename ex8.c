@@ -0,0 +1,425 @@
+// maintenir les composantes connexes pendant l'ajout des liens: un index union-find
+// optionnel attache au graphe (non oriente), mis a jour dans ajout_lien, pour repondre
+// en temps quasi constant a "u et v sont-ils connectes ?" et "taille de la composante de u".
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// union-find (foret d'ensembles disjoints) sur les sommets
+typedef struct unionfind {
+    int *parent; // parent[i] == i si i est la racine de son ensemble
+    int *taille; // taille[r] = nombre de sommets de l'ensemble de racine r
+    int nb_composantes;
+    bool a_jour; // false apres supp_lien: il faut reconstruire avant de repondre
+} UnionFind;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    Liste *listes; // tableau de n listes
+    struct unionfind *uf; // index des composantes, NULL si pas active
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->uf = NULL;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void uf_union(UnionFind *uf, int a, int b);
+
+void ajout_lien(Graphe *g, int id1, int id2) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2);
+        } else {
+            ajouterArete(g, id1, id2);
+            if (g->uf != NULL && g->uf->a_jour) { // si pas a jour, la reconstruction verra ce lien
+                uf_union(g->uf, id1, id2);
+            }
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void desactiver_index(Graphe *g);
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+    desactiver_index(g);
+}
+
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    fscanf(fichier, "%d %d %d", &oriente, &n, &m);
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    for (int i = 0; i < m; i++) {
+        fscanf(fichier, "%d %d", &id1, &id2);
+        ajout_lien(g, id1, id2);
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                printf("%d -> ", current->s.id);
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+void supp_lien(Graphe *g, int id1, int id2) {
+    int trouve = 0;
+    Noeud *current = g->listes[id1]; // acceder liste de sommets liés de id1
+    Noeud *prev = NULL; // pas de ->prec => definir *prev
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            trouve = 1;
+            if (prev == NULL) { // debut de liste
+                g->listes[id1] = current->suivant;
+            } else { // milieu ou fin de liste
+                prev->suivant = current->suivant;
+            }
+            free(current); // liberer memoire
+            g->m--; // decrementer le nombre d'aretes
+            break;
+        }
+        prev = current;
+        current = current->suivant;
+    }
+    if(trouve){
+        // si graphe non oritente -> supprimer l'arete (j, i)
+        if(!g->oriente){
+            current = g->listes[id2];
+            prev = NULL;
+            while (current != NULL) {
+                if (current->s.id == id1) {
+                    if (prev == NULL) {
+                        g->listes[id2] = current->suivant;
+                    } else {
+                        prev->suivant = current->suivant;
+                    }
+                    free(current);
+                    break;
+                }
+                prev = current;
+                current = current->suivant;
+            }
+            // union-find ne sait pas separer un ensemble -> reconstruction a la prochaine question
+            if (g->uf != NULL) {
+                g->uf->a_jour = false;
+            }
+        }
+        printf("Suppression a ete faite\n");
+    }
+    else{
+        printf("Le lien n'existe pas\n");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// union-find: union par taille + compression de chemin (par moitie)
+// ---------------------------------------------------------------------------
+
+void uf_init(UnionFind *uf, int n) {
+    uf->parent = (int *)malloc(n * sizeof(int));
+    uf->taille = (int *)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        uf->parent[i] = i; // chaque sommet seul dans son ensemble
+        uf->taille[i] = 1;
+    }
+    uf->nb_composantes = n;
+    uf->a_jour = true;
+}
+
+// racine de l'ensemble de x, on raccourcit le chemin en passant
+int uf_trouver(UnionFind *uf, int x) {
+    while (uf->parent[x] != x) {
+        uf->parent[x] = uf->parent[uf->parent[x]]; // x pointe vers son grand-parent
+        x = uf->parent[x];
+    }
+    return x;
+}
+
+void uf_union(UnionFind *uf, int a, int b) {
+    int ra = uf_trouver(uf, a);
+    int rb = uf_trouver(uf, b);
+    if (ra == rb) {
+        return; // deja dans la meme composante
+    }
+    if (uf->taille[ra] < uf->taille[rb]) { // le petit arbre sous le grand
+        int tmp = ra;
+        ra = rb;
+        rb = tmp;
+    }
+    uf->parent[rb] = ra;
+    uf->taille[ra] += uf->taille[rb];
+    uf->nb_composantes--;
+}
+
+// reconstruire l'index a partir des listes (apres supp_lien)
+void reconstruire_index(Graphe *g) {
+    UnionFind *uf = g->uf;
+    for (int i = 0; i < g->n; i++) {
+        uf->parent[i] = i;
+        uf->taille[i] = 1;
+    }
+    uf->nb_composantes = g->n;
+    for (int i = 0; i < g->n; i++) {
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            if (i < current->s.id) { // chaque arete une seule fois
+                uf_union(uf, i, current->s.id);
+            }
+            current = current->suivant;
+        }
+    }
+    uf->a_jour = true;
+}
+
+// attacher un index des composantes au graphe (seulement pour les graphes non orientes)
+bool activer_index(Graphe *g) {
+    if (g->oriente) {
+        printf("L'index des composantes est seulement pour les graphes non orientes\n");
+        return false;
+    }
+    if (g->uf == NULL) {
+        g->uf = (UnionFind *)malloc(sizeof(UnionFind));
+        uf_init(g->uf, g->n);
+    }
+    reconstruire_index(g); // le graphe a peut etre deja des liens
+    return true;
+}
+
+void desactiver_index(Graphe *g) {
+    if (g->uf != NULL) {
+        free(g->uf->parent);
+        free(g->uf->taille);
+        free(g->uf);
+        g->uf = NULL;
+    }
+}
+
+void ajout_sommet(Graphe *g, int id){
+    if(id < g->n){ // car id = index
+        printf("Le sommet existe deja\n");
+        return;
+    }
+    int ancien_n = g->n;
+    g->n = id + 1;
+    g->listes = (Liste *)realloc(g->listes, g->n * sizeof(Liste));
+    // utiliser realloc pour ne pas perdre les donnees existantes
+    for (int i = ancien_n; i < g->n; i++) {
+        g->listes[i] = NULL; // initialiser les nouvelles listes
+    }
+    if (g->uf != NULL) { // les nouveaux sommets sont des composantes isolees
+        g->uf->parent = (int *)realloc(g->uf->parent, g->n * sizeof(int));
+        g->uf->taille = (int *)realloc(g->uf->taille, g->n * sizeof(int));
+        for (int i = ancien_n; i < g->n; i++) {
+            g->uf->parent[i] = i;
+            g->uf->taille[i] = 1;
+        }
+        g->uf->nb_composantes += g->n - ancien_n;
+    }
+}
+
+// index a jour avant de repondre
+UnionFind *index_composantes(Graphe *g) {
+    if (g->uf == NULL) {
+        return NULL;
+    }
+    if (!g->uf->a_jour) {
+        reconstruire_index(g);
+    }
+    return g->uf;
+}
+
+bool connectes(Graphe *g, int id1, int id2) {
+    UnionFind *uf = index_composantes(g);
+    if (uf == NULL) {
+        printf("Index des composantes pas active\n");
+        return false;
+    }
+    return uf_trouver(uf, id1) == uf_trouver(uf, id2);
+}
+
+int taille_composante(Graphe *g, int id) {
+    UnionFind *uf = index_composantes(g);
+    if (uf == NULL) {
+        printf("Index des composantes pas active\n");
+        return 0;
+    }
+    return uf->taille[uf_trouver(uf, id)];
+}
+
+int nb_composantes(Graphe *g) {
+    UnionFind *uf = index_composantes(g);
+    return uf == NULL ? 0 : uf->nb_composantes;
+}
+
+// meme resultat que composantes mais lu dans l'index: c[i] = numero de composante
+void composantes_index(Graphe *g, int *c) {
+    UnionFind *uf = index_composantes(g);
+    if (uf == NULL) {
+        return;
+    }
+    int *numero = (int *)malloc(g->n * sizeof(int)); // numero[racine]
+    for (int i = 0; i < g->n; i++) {
+        numero[i] = -1;
+    }
+    int component_id = 0;
+    for (int i = 0; i < g->n; i++) {
+        int r = uf_trouver(uf, i);
+        if (numero[r] == -1) {
+            numero[r] = component_id++;
+        }
+        c[i] = numero[r];
+    }
+    free(numero);
+}
+
+int main(){
+    Graphe g;
+    printf("Entrer nombre de sommets: ");
+    int n;
+    scanf("%d", &n);
+    init_graphe(&g, n, false);
+    activer_index(&g);
+
+    printf("Commandes:\n");
+    printf("  a u v : ajout_lien\n");
+    printf("  s u v : supp_lien\n");
+    printf("  q u v : u et v connectes ?\n");
+    printf("  t u   : taille de la composante de u\n");
+    printf("  c     : composantes\n");
+    printf("  x     : quitter\n");
+    char cmd;
+    int u, v;
+    while (scanf(" %c", &cmd) == 1 && cmd != 'x') {
+        if (cmd == 'a' || cmd == 's' || cmd == 'q') {
+            scanf("%d %d", &u, &v);
+            if (u < 0 || u >= g.n || v < 0 || v >= g.n) {
+                printf("Sommet invalide\n");
+                continue;
+            }
+            if (cmd == 'a') {
+                ajout_lien(&g, u, v);
+            } else if (cmd == 's') {
+                supp_lien(&g, u, v);
+            } else {
+                printf("%s\n", connectes(&g, u, v) ? "Oui" : "Non");
+            }
+        } else if (cmd == 't') {
+            scanf("%d", &u);
+            if (u < 0 || u >= g.n) {
+                printf("Sommet invalide\n");
+                continue;
+            }
+            printf("Taille: %d\n", taille_composante(&g, u));
+        } else if (cmd == 'c') {
+            int *c = (int *)malloc(g.n * sizeof(int));
+            composantes_index(&g, c);
+            printf("Nombre de composantes: %d\n", nb_composantes(&g));
+            for (int i = 0; i < g.n; i++) {
+                printf("Sommet %d: Composante %d\n", i, c[i]);
+            }
+            free(c);
+        }
+    }
+
+    liberer_graphe(&g);
+    return 0;
+}
@@ -0,0 +1,579 @@
+// liens avec poids (optionnels, par ex. latence ou cout) et plus courts chemins depuis
+// une source: Dijkstra avec un tas 4-aire et delta-stepping en parallele, retour par
+// un tableau de distances et le tableau p des predecesseurs comme pour parcours.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <pthread.h>
+
+//A chaque sommet on associe un identifiant entier
+typedef struct {
+  int id;
+} Sommet;
+
+// une cellule d'une liste contient un sommet, le poids du lien et un pointeur vers la cellule suivante
+typedef struct noeud {
+    Sommet s;
+    double poids; // 1 si le graphe n'est pas pondere
+    struct noeud *suivant;
+} Noeud;
+
+//une liste est un pointeur sur l'element de tete
+typedef Noeud *Liste;
+
+// graphe caracterise par
+typedef struct {
+    bool oriente; // true si le graphe est oriente, false sinon
+    int n; // nombre de sommets
+    int m; // nombre d'aretes (arcs)
+    bool pondere; // true si au moins un lien a un poids dans le fichier
+    Liste *listes; // tableau de n listes
+} Graphe;
+
+void init_graphe(Graphe *g, int n, bool oriente) {
+    g->oriente = oriente;
+    g->n = n;
+    g->m = 0;
+    g->pondere = false;
+    g->listes = (Liste *)malloc(n * sizeof(Liste)); // allocation dynamique
+    for (int i = 0; i < n; i++) { // initialisation des elements
+        g->listes[i] = NULL;
+    }
+}
+
+// fonction qui verifie si un lien existe entre deux sommets
+bool lien_existe(Graphe *g, int id1, int id2) {
+    Noeud *current = g->listes[id1]; // id1 = index
+    while (current != NULL) {
+        if (current->s.id == id2) { // trouve lien
+            return true;
+        }
+        current = current->suivant;
+    }
+    return false;
+}
+
+// fonction pour ajouter un arc (pour les graphes orientes)
+void ajouterArc(Graphe *g, int id1, int id2, double poids) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique pour noeud
+    n->s.id = id2; // set sommet pour noeud
+    n->poids = poids;
+    n->suivant = g->listes[id1]; // ajouter debut de liste sommet liés
+    g->listes[id1] = n; // changer le debut de liste
+    g->m++; // incrementer le nombre d'aretes
+}
+
+// fonction pour ajouter une arete (pour les graphes non-orientes)
+void ajouterArete(Graphe *g, int id1, int id2, double poids) {
+    Noeud *n = (Noeud *)malloc(sizeof(Noeud)); // allocation dynamique
+    n->s.id = id2; // set sommet = id2
+    n->poids = poids;
+    n->suivant = g->listes[id1];
+    g->listes[id1] = n;
+    g->m++;
+    if(id1 != id2) { // pas boucle
+        ajouterArc(g, id2, id1, poids); // on ajoute l'arete (j, i)
+        g->m--; // decrementer car on a ajoute deux fois
+    }
+}
+
+void ajout_lien(Graphe *g, int id1, int id2, double poids) {
+    if (!lien_existe(g, id1, id2)) { // si le lien n'existe pas
+        if (g->oriente) {
+            ajouterArc(g, id1, id2, poids);
+        } else {
+            ajouterArete(g, id1, id2, poids);
+        }
+    }
+    else{
+        printf("Le lien existe deja\n");
+    }
+}
+
+int longueur_liste(Liste l) {
+    int longueur = 0;
+    Noeud *current = l;
+    while (current != NULL) {
+        longueur++;
+        current = current->suivant;
+    }
+    return longueur;
+}
+
+void liberer_graphe(Graphe *g){
+    for(int i = 0; i < g->n; i++){
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            Noeud *temp = current;
+            current = current->suivant;
+            free(temp); // liberer chaque noeud
+        }
+    }
+    free(g->listes); // liberer le tableau de listes
+}
+
+// format: "oriente n m" puis une ligne par lien "id1 id2" ou "id1 id2 poids"
+// (sans poids -> poids 1, les anciens fichiers se chargent toujours)
+void charge(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "r");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    int n, m, oriente;
+    char ligne[256];
+    if (fgets(ligne, sizeof(ligne), fichier) == NULL || sscanf(ligne, "%d %d %d", &oriente, &n, &m) != 3) {
+        printf("Erreur: entete invalide\n");
+        fclose(fichier);
+        return;
+    }
+    init_graphe(g, n, oriente);
+
+    int id1, id2;
+    double poids;
+    for (int i = 0; i < m && fgets(ligne, sizeof(ligne), fichier) != NULL; i++) {
+        int lus = sscanf(ligne, "%d %d %lf", &id1, &id2, &poids);
+        if (lus < 2) {
+            i--; // ligne vide
+            continue;
+        }
+        if (lus == 3) {
+            g->pondere = true;
+        } else {
+            poids = 1;
+        }
+        ajout_lien(g, id1, id2, poids);
+    }
+    fclose(fichier);
+}
+
+void sauvegarder(Graphe *g, const char *nom_fichier){
+    FILE *fichier = fopen(nom_fichier, "w");
+    if (fichier == NULL) {
+        printf("Erreur lors de l'ouverture du fichier\n");
+        return;
+    }
+    fprintf(fichier, "%d %d %d\n", g->oriente, g->n, g->m);
+    for (int i = 0; i < g->n; i++) {
+        Noeud *current = g->listes[i];
+        while (current != NULL) {
+            if (g->oriente || i < current->s.id) { // prevent duplication in non or graph
+                if (g->pondere) {
+                    fprintf(fichier, "%d %d %.17g\n", i, current->s.id, current->poids);
+                } else {
+                    fprintf(fichier, "%d %d\n", i, current->s.id);
+                }
+            }
+            current = current->suivant;
+        }
+    }
+    fclose(fichier);
+}
+
+void afficher_simple(Graphe *g){
+    printf("Nombre de sommets: %d\n", g->n);
+    printf("Nombre de connexions: %d\n", g->m);
+    printf("Type: %s\n", g->oriente ? "Oriente" : "Non oriente");
+    printf("Listes d'adjacence:\n");
+    for (int i = 0; i < g->n; i++) {
+        if (g->listes[i] != NULL) {
+            printf("Sommet %d: ", i);
+            Noeud *current = g->listes[i];
+            while (current != NULL) {
+                if (g->pondere) {
+                    printf("%d (%g) -> ", current->s.id, current->poids);
+                } else {
+                    printf("%d -> ", current->s.id);
+                }
+                current = current->suivant;
+            }
+            printf("Null\n");
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Dijkstra avec un tas 4-aire (un noeud a 4 fils: arbre moins profond qu'un tas
+// binaire et les 4 fils sont contigus en memoire)
+// ---------------------------------------------------------------------------
+
+#define ARITE 4
+
+typedef struct {
+    int *tas; // sommets, tas[0] = sommet de plus petite distance
+    int *pos; // pos[v] = indice de v dans tas, -1 si absent
+    double *cle; // cle[v] = distance de v (tableau dist partage)
+    int taille;
+} TasDAire;
+
+void tas_init(TasDAire *t, int n, double *cle) {
+    t->tas = (int *)malloc(n * sizeof(int));
+    t->pos = (int *)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        t->pos[i] = -1;
+    }
+    t->cle = cle;
+    t->taille = 0;
+}
+
+void tas_liberer(TasDAire *t) {
+    free(t->tas);
+    free(t->pos);
+}
+
+void tas_monter(TasDAire *t, int i) {
+    int v = t->tas[i];
+    double c = t->cle[v];
+    while (i > 0) {
+        int parent = (i - 1) / ARITE;
+        if (t->cle[t->tas[parent]] <= c) {
+            break;
+        }
+        t->tas[i] = t->tas[parent]; // on descend le parent, v sera place a la fin
+        t->pos[t->tas[i]] = i;
+        i = parent;
+    }
+    t->tas[i] = v;
+    t->pos[v] = i;
+}
+
+void tas_descendre(TasDAire *t, int i) {
+    int v = t->tas[i];
+    double c = t->cle[v];
+    while (true) {
+        int premier = ARITE * i + 1;
+        if (premier >= t->taille) {
+            break;
+        }
+        int dernier = premier + ARITE < t->taille ? premier + ARITE : t->taille;
+        int min = premier;
+        for (int j = premier + 1; j < dernier; j++) { // plus petit des fils
+            if (t->cle[t->tas[j]] < t->cle[t->tas[min]]) {
+                min = j;
+            }
+        }
+        if (t->cle[t->tas[min]] >= c) {
+            break;
+        }
+        t->tas[i] = t->tas[min];
+        t->pos[t->tas[i]] = i;
+        i = min;
+    }
+    t->tas[i] = v;
+    t->pos[v] = i;
+}
+
+// inserer v ou diminuer sa cle (cle[v] deja mise a jour par l'appelant)
+void tas_diminuer(TasDAire *t, int v) {
+    if (t->pos[v] == -1) {
+        t->tas[t->taille] = v;
+        t->pos[v] = t->taille;
+        t->taille++;
+    }
+    tas_monter(t, t->pos[v]);
+}
+
+int tas_extraire_min(TasDAire *t) {
+    int v = t->tas[0];
+    t->pos[v] = -1;
+    t->taille--;
+    if (t->taille > 0) {
+        t->tas[0] = t->tas[t->taille];
+        tas_descendre(t, 0);
+    }
+    return v;
+}
+
+bool poids_negatif(Graphe *G) {
+    for (int i = 0; i < G->n; i++) {
+        for (Noeud *current = G->listes[i]; current != NULL; current = current->suivant) {
+            if (current->poids < 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// plus courts chemins depuis id: dist[v] (INFINITY si inaccessible) et p[v] predecesseur
+// (-1 si pas de predecesseur), comme le tableau p de parcours
+void dijkstra(Graphe *G, int id, double *dist, int *p) {
+    for (int i = 0; i < G->n; i++) {
+        dist[i] = INFINITY;
+        p[i] = -1;
+    }
+    if (poids_negatif(G)) {
+        printf("Erreur: Dijkstra ne marche pas avec des poids negatifs\n");
+        return;
+    }
+    TasDAire t;
+    tas_init(&t, G->n, dist);
+    dist[id] = 0;
+    tas_diminuer(&t, id);
+    while (t.taille > 0) {
+        int u = tas_extraire_min(&t); // dist[u] est definitive
+        for (Noeud *current = G->listes[u]; current != NULL; current = current->suivant) {
+            int v = current->s.id;
+            double nd = dist[u] + current->poids;
+            if (nd < dist[v]) { // relaxation
+                dist[v] = nd;
+                p[v] = u;
+                tas_diminuer(&t, v);
+            }
+        }
+    }
+    tas_liberer(&t);
+}
+
+// ---------------------------------------------------------------------------
+// delta-stepping parallele: les sommets sont ranges dans des seaux de largeur delta,
+// tous les sommets d'un seau sont traites en meme temps (en parallele)
+// - liens legers (poids <= delta): peuvent remettre des sommets dans le seau courant,
+//   on recommence tant que le seau n'est pas vide
+// - liens lourds: relaches une seule fois quand le seau est fini
+// chaque thread produit des demandes (v, distance, u), appliquees ensuite par le thread
+// principal -> pas de verrou sur dist
+// ---------------------------------------------------------------------------
+
+#define MAX_THREADS 64
+#define SEUIL_PARALLELE 1024 // en dessous, un seul thread suffit
+
+typedef struct {
+    int *sommets;
+    int nb;
+    int capacite;
+} Tableau;
+
+typedef struct {
+    int v;
+    double d;
+    int u;
+} Demande;
+
+typedef struct {
+    Graphe *G;
+    double *dist;
+    double delta;
+    bool legers; // true: liens legers, false: liens lourds
+    int *sommets; // sommets a relacher [debut, fin)
+    int debut, fin;
+    Demande *demandes;
+    int nb_demandes;
+    int capacite;
+} Travail;
+
+void tableau_ajouter(Tableau *t, int v) {
+    if (t->nb == t->capacite) {
+        t->capacite = t->capacite == 0 ? 16 : 2 * t->capacite;
+        t->sommets = (int *)realloc(t->sommets, t->capacite * sizeof(int));
+    }
+    t->sommets[t->nb++] = v;
+}
+
+void *thread_relacher(void *arg) {
+    Travail *w = (Travail *)arg;
+    w->nb_demandes = 0;
+    for (int k = w->debut; k < w->fin; k++) {
+        int u = w->sommets[k];
+        for (Noeud *current = w->G->listes[u]; current != NULL; current = current->suivant) {
+            if ((current->poids <= w->delta) != w->legers) {
+                continue;
+            }
+            double nd = w->dist[u] + current->poids;
+            if (nd < w->dist[current->s.id]) { // lecture seule ici, verifie a nouveau a l'application
+                if (w->nb_demandes == w->capacite) {
+                    w->capacite = w->capacite == 0 ? 64 : 2 * w->capacite;
+                    w->demandes = (Demande *)realloc(w->demandes, w->capacite * sizeof(Demande));
+                }
+                w->demandes[w->nb_demandes].v = current->s.id;
+                w->demandes[w->nb_demandes].d = nd;
+                w->demandes[w->nb_demandes].u = u;
+                w->nb_demandes++;
+            }
+        }
+    }
+    return NULL;
+}
+
+// met v dans le seau de sa distance, en agrandissant le tableau de seaux si besoin
+void mettre_dans_seau(Tableau **seaux, int *nb_seaux, int v, double d, double delta) {
+    int b = (int)(d / delta);
+    if (b >= *nb_seaux) {
+        int ancien = *nb_seaux;
+        int nouveau = ancien;
+        while (nouveau <= b) {
+            nouveau = nouveau == 0 ? 16 : 2 * nouveau;
+        }
+        *seaux = (Tableau *)realloc(*seaux, nouveau * sizeof(Tableau));
+        for (int i = ancien; i < nouveau; i++) {
+            (*seaux)[i].sommets = NULL;
+            (*seaux)[i].nb = 0;
+            (*seaux)[i].capacite = 0;
+        }
+        *nb_seaux = nouveau;
+    }
+    tableau_ajouter(&(*seaux)[b], v);
+}
+
+// relache les liens (legers ou lourds) de sommets[0..nb) avec nb_threads threads,
+// puis applique les demandes
+void relacher(Graphe *G, double *dist, int *p, double delta, bool legers, int *sommets, int nb,
+              int nb_threads, Travail *travaux, Tableau **seaux, int *nb_seaux) {
+    int t_utiles = nb < SEUIL_PARALLELE ? 1 : nb_threads;
+    pthread_t threads[MAX_THREADS];
+    for (int t = 0; t < t_utiles; t++) {
+        travaux[t].G = G;
+        travaux[t].dist = dist;
+        travaux[t].delta = delta;
+        travaux[t].legers = legers;
+        travaux[t].sommets = sommets;
+        travaux[t].debut = (int)((long)nb * t / t_utiles);
+        travaux[t].fin = (int)((long)nb * (t + 1) / t_utiles);
+        if (t_utiles == 1) {
+            thread_relacher(&travaux[t]);
+        } else {
+            pthread_create(&threads[t], NULL, thread_relacher, &travaux[t]);
+        }
+    }
+    // attendre tous les threads avant de toucher a dist: ils le lisent encore
+    if (t_utiles > 1) {
+        for (int t = 0; t < t_utiles; t++) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+    for (int t = 0; t < t_utiles; t++) {
+        for (int k = 0; k < travaux[t].nb_demandes; k++) {
+            Demande *r = &travaux[t].demandes[k];
+            if (r->d < dist[r->v]) {
+                dist[r->v] = r->d;
+                p[r->v] = r->u;
+                mettre_dans_seau(seaux, nb_seaux, r->v, r->d, delta);
+            }
+        }
+    }
+}
+
+// meme resultat que dijkstra (distances), delta <= 0: delta = poids moyen
+void delta_stepping(Graphe *G, int id, double *dist, int *p, double delta, int nb_threads) {
+    for (int i = 0; i < G->n; i++) {
+        dist[i] = INFINITY;
+        p[i] = -1;
+    }
+    if (poids_negatif(G)) {
+        printf("Erreur: delta-stepping ne marche pas avec des poids negatifs\n");
+        return;
+    }
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+    if (delta <= 0) {
+        double somme = 0;
+        long nb = 0;
+        for (int i = 0; i < G->n; i++) {
+            for (Noeud *current = G->listes[i]; current != NULL; current = current->suivant) {
+                somme += current->poids;
+                nb++;
+            }
+        }
+        delta = (nb > 0 && somme > 0) ? somme / nb : 1;
+    }
+
+    Tableau *seaux = NULL;
+    int nb_seaux = 0;
+    Travail travaux[MAX_THREADS];
+    for (int t = 0; t < nb_threads; t++) {
+        travaux[t].demandes = NULL;
+        travaux[t].capacite = 0;
+        travaux[t].nb_demandes = 0;
+    }
+    int *courant = (int *)malloc(G->n * sizeof(int)); // sommets pris dans le seau
+    int *regle = (int *)malloc(G->n * sizeof(int)); // sommets sortis du seau b (pour les liens lourds)
+    int *dans = (int *)malloc(G->n * sizeof(int)); // dans[v] = dernier seau ou v a ete pris
+    int *dans_courant = (int *)malloc(G->n * sizeof(int)); // evite les doublons dans courant
+    for (int i = 0; i < G->n; i++) {
+        dans[i] = -1;
+        dans_courant[i] = -1;
+    }
+
+    dist[id] = 0;
+    mettre_dans_seau(&seaux, &nb_seaux, id, 0, delta);
+    int etape = 0;
+    for (int b = 0; b < nb_seaux; b++) {
+        int nb_regle = 0;
+        while (seaux[b].nb > 0) {
+            // vider le seau: seuls les sommets dont la distance est toujours dans b comptent
+            int nb_courant = 0;
+            etape++;
+            for (int k = 0; k < seaux[b].nb; k++) {
+                int v = seaux[b].sommets[k];
+                if ((int)(dist[v] / delta) == b && dans_courant[v] != etape) {
+                    dans_courant[v] = etape;
+                    courant[nb_courant++] = v;
+                    if (dans[v] != b) {
+                        dans[v] = b;
+                        regle[nb_regle++] = v;
+                    }
+                }
+            }
+            seaux[b].nb = 0;
+            relacher(G, dist, p, delta, true, courant, nb_courant, nb_threads, travaux, &seaux, &nb_seaux);
+        }
+        relacher(G, dist, p, delta, false, regle, nb_regle, nb_threads, travaux, &seaux, &nb_seaux);
+    }
+
+    for (int i = 0; i < nb_seaux; i++) {
+        free(seaux[i].sommets);
+    }
+    free(seaux);
+    for (int t = 0; t < nb_threads; t++) {
+        free(travaux[t].demandes);
+    }
+    free(courant);
+    free(regle);
+    free(dans);
+    free(dans_courant);
+}
+
+void afficher_chemins(int id, double *dist, int *p, int n) {
+    printf("Sommet\tDistance\tPredecesseur\n");
+    for (int i = 0; i < n; i++) {
+        if (i != id && p[i] == -1) continue; // si sommet n'est pas accessible
+        printf("%d\t%g\t\t%d\n", i, dist[i], p[i]);
+    }
+}
+
+int main(){
+    Graphe g;
+    charge(&g, "mon_graphe.txt");
+    afficher_simple(&g);
+
+    printf("\nEntrer sommet source: ");
+    int id;
+    scanf("%d", &id);
+    if (id < 0 || id >= g.n) {
+        printf("Sommet invalide\n");
+        liberer_graphe(&g);
+        return 1;
+    }
+    printf("Dijkstra (0) ou delta-stepping parallele (1): ");
+    int methode;
+    scanf("%d", &methode);
+
+    double *dist = (double *)malloc(g.n * sizeof(double));
+    int *p = (int *)malloc(g.n * sizeof(int));
+    if (methode == 0) {
+        dijkstra(&g, id, dist, p);
+    } else {
+        printf("Nombre de threads: ");
+        int nb_threads;
+        scanf("%d", &nb_threads);
+        delta_stepping(&g, id, dist, p, 0, nb_threads);
+    }
+    afficher_chemins(id, dist, p, g.n);
+
+    free(dist);
+    free(p);
+    liberer_graphe(&g);
+    return 0;
+}